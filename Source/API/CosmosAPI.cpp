@@ -0,0 +1,227 @@
+#include "CosmosAPI.h"
+#include "../DSP/CosmosEngine.h"
+#include <cmath>
+#include <new>
+
+//==============================================================================
+struct cosmos_engine
+{
+    Cosmos::CosmosEngine engine;
+    double sampleRate = 0.0;
+    int maxBlockSize = 0;
+};
+
+namespace
+{
+
+float* getSettingsField(Cosmos::CosmosEngine::Settings& settings, cosmos_param param)
+{
+    switch (param)
+    {
+        case COSMOS_PARAM_DECAY:            return &settings.decay;
+        case COSMOS_PARAM_PRE_DELAY:        return &settings.preDelay;
+        case COSMOS_PARAM_HIGH_CUT:         return &settings.highCut;
+        case COSMOS_PARAM_LOW_CUT:          return &settings.lowCut;
+        case COSMOS_PARAM_MIX:              return &settings.mix;
+        case COSMOS_PARAM_WIDTH:            return &settings.width;
+        case COSMOS_PARAM_DIFFUSION_THRUST: return &settings.diffusionThrust;
+        case COSMOS_PARAM_MODULATION_CHAOS: return &settings.modulationChaos;
+        case COSMOS_PARAM_INPUT_GAIN:       return &settings.inputGain;
+        case COSMOS_PARAM_OUTPUT_GAIN:      return &settings.outputGain;
+        case COSMOS_NUM_PARAMS:
+        default:                            return nullptr;
+    }
+}
+
+// Same limits as the plugin's parameter layout in Parameters.h
+juce::Range<float> getParamRange(cosmos_param param)
+{
+    using namespace Cosmos::Ranges;
+
+    switch (param)
+    {
+        case COSMOS_PARAM_DECAY:            return { decayMin, decayMax };
+        case COSMOS_PARAM_PRE_DELAY:        return { preDelayMin, preDelayMax };
+        case COSMOS_PARAM_HIGH_CUT:         return { highCutMin, highCutMax };
+        case COSMOS_PARAM_LOW_CUT:          return { lowCutMin, lowCutMax };
+        case COSMOS_PARAM_MIX:              return { 0.0f, 100.0f };
+        case COSMOS_PARAM_WIDTH:            return { 0.0f, 200.0f };
+        case COSMOS_PARAM_DIFFUSION_THRUST: return { 0.0f, 100.0f };
+        case COSMOS_PARAM_MODULATION_CHAOS: return { 0.0f, 100.0f };
+        case COSMOS_PARAM_INPUT_GAIN:
+        case COSMOS_PARAM_OUTPUT_GAIN:      return { gainMin, gainMax };
+        case COSMOS_NUM_PARAMS:
+        default:                            return {};
+    }
+}
+
+bool isPrepared(const cosmos_engine* engine)
+{
+    return engine != nullptr && engine->maxBlockSize > 0;
+}
+
+} // namespace
+
+//==============================================================================
+int cosmos_get_api_version(void)
+{
+    return COSMOS_API_VERSION;
+}
+
+cosmos_engine* cosmos_create(void)
+{
+    return new (std::nothrow) cosmos_engine();
+}
+
+void cosmos_destroy(cosmos_engine* engine)
+{
+    delete engine;
+}
+
+cosmos_status cosmos_prepare(cosmos_engine* engine, double sample_rate, int max_block_size)
+{
+    if (engine == nullptr || sample_rate <= 0.0 || max_block_size <= 0)
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    try
+    {
+        engine->engine.prepare(sample_rate, max_block_size);
+    }
+    catch (const std::bad_alloc&)
+    {
+        engine->maxBlockSize = 0;
+        return COSMOS_ERROR_OUT_OF_MEMORY;
+    }
+
+    engine->sampleRate = sample_rate;
+    engine->maxBlockSize = max_block_size;
+    return COSMOS_OK;
+}
+
+cosmos_status cosmos_reset(cosmos_engine* engine)
+{
+    if (!isPrepared(engine))
+        return engine == nullptr ? COSMOS_ERROR_INVALID_ARGUMENT : COSMOS_ERROR_NOT_PREPARED;
+
+    engine->engine.reset();
+    return COSMOS_OK;
+}
+
+cosmos_status cosmos_set_param(cosmos_engine* engine, cosmos_param param, float value)
+{
+    if (engine == nullptr || !std::isfinite(value))
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    auto settings = engine->engine.getSettings();
+    float* field = getSettingsField(settings, param);
+
+    if (field == nullptr)
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    *field = getParamRange(param).clipValue(value);
+    engine->engine.setSettings(settings);
+    return COSMOS_OK;
+}
+
+float cosmos_get_param(const cosmos_engine* engine, cosmos_param param)
+{
+    if (engine == nullptr)
+        return 0.0f;
+
+    auto settings = engine->engine.getSettings();
+    const float* field = getSettingsField(settings, param);
+    return field != nullptr ? *field : 0.0f;
+}
+
+cosmos_status cosmos_load_preset(cosmos_engine* engine, int preset_index)
+{
+    if (engine == nullptr || preset_index < 0 || preset_index >= Cosmos::NebulaPresets::getNumPresets())
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    const auto& current = engine->engine.getSettings();
+    auto settings = Cosmos::CosmosEngine::Settings::fromPreset(preset_index);
+    settings.mix = current.mix;
+    settings.inputGain = current.inputGain;
+    settings.outputGain = current.outputGain;
+
+    engine->engine.setSettings(settings);
+    return COSMOS_OK;
+}
+
+int cosmos_get_num_presets(void)
+{
+    return Cosmos::NebulaPresets::getNumPresets();
+}
+
+const char* cosmos_get_preset_name(int preset_index)
+{
+    if (preset_index < 0 || preset_index >= Cosmos::NebulaPresets::getNumPresets())
+        return nullptr;
+
+    return Cosmos::NebulaPresets::getPreset(preset_index).name;
+}
+
+//==============================================================================
+cosmos_status cosmos_process_interleaved(cosmos_engine* engine, float* data, int num_channels, int num_frames)
+{
+    if (engine == nullptr || data == nullptr || num_channels < 1 || num_channels > 2 || num_frames < 0)
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    if (!isPrepared(engine))
+        return COSMOS_ERROR_NOT_PREPARED;
+
+    // Processed in place through a strided view, without deinterleaving
+    engine->engine.process(Cosmos::AudioView::interleaved(data, num_channels, num_frames));
+    return COSMOS_OK;
+}
+
+cosmos_status cosmos_process_planar(cosmos_engine* engine, float* const* channels, int num_channels, int num_frames)
+{
+    if (engine == nullptr || channels == nullptr || num_channels < 1 || num_channels > 2 || num_frames < 0)
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    for (int ch = 0; ch < num_channels; ++ch)
+        if (channels[ch] == nullptr)
+            return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    if (!isPrepared(engine))
+        return COSMOS_ERROR_NOT_PREPARED;
+
+    engine->engine.process(Cosmos::AudioView::planar(channels, num_channels, num_frames));
+    return COSMOS_OK;
+}
+
+//==============================================================================
+cosmos_status cosmos_set_seed(cosmos_engine* engine, uint32_t seed)
+{
+    if (!isPrepared(engine))
+        return engine == nullptr ? COSMOS_ERROR_INVALID_ARGUMENT : COSMOS_ERROR_NOT_PREPARED;
+
+    engine->engine.setSeed(seed);
+    return COSMOS_OK;
+}
+
+cosmos_status cosmos_set_position(cosmos_engine* engine, int64_t sample_position)
+{
+    if (!isPrepared(engine))
+        return engine == nullptr ? COSMOS_ERROR_INVALID_ARGUMENT : COSMOS_ERROR_NOT_PREPARED;
+
+    if (sample_position < 0)
+        return COSMOS_ERROR_INVALID_ARGUMENT;
+
+    engine->engine.setPosition(sample_position);
+    return COSMOS_OK;
+}
+
+double cosmos_get_tail_length_seconds(const cosmos_engine* engine)
+{
+    return engine != nullptr ? engine->engine.getTailLengthSeconds() : 0.0;
+}
+
+int64_t cosmos_get_tail_length_samples(const cosmos_engine* engine)
+{
+    if (!isPrepared(engine))
+        return 0;
+
+    return static_cast<int64_t>(engine->engine.getTailLengthSeconds() * engine->sampleRate);
+}
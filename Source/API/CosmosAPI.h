@@ -0,0 +1,116 @@
+/*
+  ==============================================================================
+    Cosmos - Cinematic Space Reverb
+    C API for embedding the Cosmos engine
+
+    Stable C interface to the host-independent processing chain
+    (input gain -> reverb -> wet/dry mix -> output gain), for services that
+    run Cosmos without a plugin host.
+
+    - Handles are opaque; create one per stream with cosmos_create().
+    - Calls on one handle must not overlap. Different handles are independent
+      and may be used from different threads.
+    - Processing works in place on caller-owned memory, interleaved or planar,
+      without copying or allocating. Blocks of any length are accepted and
+      split internally.
+    - Parameters use the plugin units (seconds, ms, Hz, percent, dB).
+  ==============================================================================
+*/
+
+#pragma once
+
+#include <stdint.h>
+
+#if defined(_WIN32)
+ #if defined(COSMOS_API_BUILD)
+  #define COSMOS_API __declspec(dllexport)
+ #else
+  #define COSMOS_API __declspec(dllimport)
+ #endif
+#else
+ #define COSMOS_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Incremented on any incompatible change to this header */
+#define COSMOS_API_VERSION 1
+
+typedef struct cosmos_engine cosmos_engine;
+
+typedef enum cosmos_status
+{
+    COSMOS_OK = 0,
+    COSMOS_ERROR_INVALID_ARGUMENT = -1,
+    COSMOS_ERROR_NOT_PREPARED = -2,
+    COSMOS_ERROR_OUT_OF_MEMORY = -3
+} cosmos_status;
+
+typedef enum cosmos_param
+{
+    COSMOS_PARAM_DECAY = 0,             /* seconds, 0.5 - 30 */
+    COSMOS_PARAM_PRE_DELAY,             /* ms, 0 - 500 */
+    COSMOS_PARAM_HIGH_CUT,              /* Hz, 1000 - 20000 */
+    COSMOS_PARAM_LOW_CUT,               /* Hz, 20 - 500 */
+    COSMOS_PARAM_MIX,                   /* percent, 0 - 100 */
+    COSMOS_PARAM_WIDTH,                 /* percent, 0 - 200 */
+    COSMOS_PARAM_DIFFUSION_THRUST,      /* percent, 0 - 100 */
+    COSMOS_PARAM_MODULATION_CHAOS,      /* percent, 0 - 100 */
+    COSMOS_PARAM_INPUT_GAIN,            /* dB, -24 - 12 */
+    COSMOS_PARAM_OUTPUT_GAIN,           /* dB, -24 - 12 */
+    COSMOS_NUM_PARAMS
+} cosmos_param;
+
+/* Version of the API this library implements (COSMOS_API_VERSION) */
+COSMOS_API int cosmos_get_api_version(void);
+
+/* Returns NULL if the engine cannot be allocated */
+COSMOS_API cosmos_engine* cosmos_create(void);
+COSMOS_API void cosmos_destroy(cosmos_engine* engine);
+
+/* Allocates all processing memory. Call before processing and whenever the
+   sample rate changes; resets the tank. */
+COSMOS_API cosmos_status cosmos_prepare(cosmos_engine* engine, double sample_rate, int max_block_size);
+
+/* Clears the tank and snaps parameter smoothing to the current values */
+COSMOS_API cosmos_status cosmos_reset(cosmos_engine* engine);
+
+/* Supported before cosmos_prepare: values set then are kept and apply
+   unsmoothed from the first prepare. Changes made after prepare/reset are
+   smoothed. Values are clamped to the ranges above; NaN and infinities
+   return COSMOS_ERROR_INVALID_ARGUMENT.
+   Not real-time safe: every call recomputes the engine's filters, so call it
+   from a control thread, never concurrently with cosmos_process_*. */
+COSMOS_API cosmos_status cosmos_set_param(cosmos_engine* engine, cosmos_param param, float value);
+COSMOS_API float cosmos_get_param(const cosmos_engine* engine, cosmos_param param);
+
+/* Loads the settings of nebula preset 0 - 11 (mix and gains are kept).
+   Supported before cosmos_prepare and, like cosmos_set_param, not for use
+   from the audio callback. */
+COSMOS_API cosmos_status cosmos_load_preset(cosmos_engine* engine, int preset_index);
+COSMOS_API int cosmos_get_num_presets(void);
+COSMOS_API const char* cosmos_get_preset_name(int preset_index);
+
+/* In-place processing of num_frames frames of 1 or 2 channels.
+   Interleaved: frames are consecutive, channels adjacent within a frame.
+   Planar: one pointer per channel. */
+COSMOS_API cosmos_status cosmos_process_interleaved(cosmos_engine* engine, float* data,
+                                                    int num_channels, int num_frames);
+COSMOS_API cosmos_status cosmos_process_planar(cosmos_engine* engine, float* const* channels,
+                                               int num_channels, int num_frames);
+
+/* Deterministic modulation: with a seed set, the output is a pure function
+   of the input, the parameters and the seed. Call after prepare/reset.
+   cosmos_set_position jumps the modulation to an absolute sample position. */
+COSMOS_API cosmos_status cosmos_set_seed(cosmos_engine* engine, uint32_t seed);
+COSMOS_API cosmos_status cosmos_set_position(cosmos_engine* engine, int64_t sample_position);
+
+/* Length of the tail after the input ends (pre-delay + decay) */
+COSMOS_API double cosmos_get_tail_length_seconds(const cosmos_engine* engine);
+COSMOS_API int64_t cosmos_get_tail_length_samples(const cosmos_engine* engine);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,6 +3,8 @@
 #include "DiffusionNetwork.h"
 #include "CombFilter.h"
 #include "ModulationEngine.h"
+#include "Biquad.h"
+#include "AudioView.h"
 #include <juce_dsp/juce_dsp.h>
 #include <array>
 
@@ -20,6 +22,13 @@ namespace Cosmos
  * - Modulation engine (Stage 2: Modulation Chaos)
  * - High/Low shelving filters for tonal shaping
  * - True stereo processing with width control
+ *
+ * The complete tank state can be captured into a Snapshot and restored
+ * later, without allocating on the audio thread.
+ *
+ * process() accepts an AudioBuffer or an AudioView over interleaved or
+ * planar caller memory of any length; it works through the input in chunks
+ * of at most the prepared block size and never allocates.
  */
 class AlgorithmicReverb
 {
@@ -31,7 +40,8 @@ public:
     void prepare(double sr, int maxBlockSize)
     {
         sampleRate = sr;
-        blockSize = maxBlockSize;
+        blockSize = juce::jmax(1, maxBlockSize);
+        wetBuffer.setSize(2, blockSize);
 
         // Pre-delay: up to 500ms
         int maxPreDelaySamples = static_cast<int>(0.5 * sampleRate);
@@ -41,6 +51,7 @@ public:
             std::fill(preDelayBuffer[ch].begin(), preDelayBuffer[ch].end(), 0.0f);
         }
         preDelayWriteIndex = 0;
+        updatePreDelay();
 
         // Initialize diffusion network
         diffusionNetwork.prepare(sampleRate, maxBlockSize);
@@ -69,13 +80,11 @@ public:
         modulationEngine.prepare(sampleRate);
 
         // Initialize filters
-        juce::dsp::ProcessSpec spec;
-        spec.sampleRate = sampleRate;
-        spec.maximumBlockSize = static_cast<juce::uint32>(maxBlockSize);
-        spec.numChannels = 2;
-
-        highCutFilter.prepare(spec);
-        lowCutFilter.prepare(spec);
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            highCutFilter[static_cast<size_t>(ch)].reset();
+            lowCutFilter[static_cast<size_t>(ch)].reset();
+        }
 
         updateFilters();
         updateDecay();
@@ -90,12 +99,13 @@ public:
             {
                 combFilters[ch][static_cast<size_t>(i)].reset();
             }
+
+            highCutFilter[static_cast<size_t>(ch)].reset();
+            lowCutFilter[static_cast<size_t>(ch)].reset();
         }
         preDelayWriteIndex = 0;
         diffusionNetwork.reset();
         modulationEngine.reset();
-        highCutFilter.reset();
-        lowCutFilter.reset();
     }
 
     // Set decay time in seconds
@@ -105,12 +115,12 @@ public:
         updateDecay();
     }
 
-    // Set pre-delay in milliseconds
+    // Set pre-delay in milliseconds. May be called before prepare(); the
+    // time is kept and converted to samples once the buffer exists.
     void setPreDelay(float preDelayMs)
     {
-        preDelaySamples = static_cast<int>(preDelayMs * sampleRate / 1000.0);
-        preDelaySamples = juce::jlimit(0, static_cast<int>(preDelayBuffer[0].size()) - 1,
-                                       preDelaySamples);
+        preDelayTime = juce::jmax(0.0f, preDelayMs);
+        updatePreDelay();
     }
 
     // Set high cut frequency
@@ -145,30 +155,203 @@ public:
         modulationEngine.setChaos(chaos);
     }
 
+    // Enable deterministic modulation (offline rendering)
+    void setModulationSeed(juce::uint32 seed)
+    {
+        modulationEngine.setSeed(seed);
+    }
+
+    // Jump the deterministic modulation to an absolute sample position
+    void setModulationPosition(juce::int64 position)
+    {
+        modulationEngine.setPosition(position);
+    }
+
+    //==========================================================================
+    /**
+     * Captured tank state: pre-delay, diffusion, comb filters, damping filters
+     * and modulation.
+     *
+     * Parameters are not part of a snapshot; restore into a reverb with the
+     * same settings to continue exactly where the snapshot was taken.
+     */
+    class Snapshot
+    {
+    public:
+        Snapshot() = default;
+
+        // True once the snapshot holds a saved state
+        bool isValid() const { return valid; }
+
+        // Memory held by the delay line contents
+        size_t getSizeInBytes() const { return samples.size() * sizeof(float); }
+
+    private:
+        friend class AlgorithmicReverb;
+
+        std::vector<float> samples;     // Delay lines: pre-delay, diffusion, combs
+        double sampleRate = 0.0;
+        bool valid = false;
+
+        int preDelayWriteIndex = 0;
+        DiffusionNetwork::State diffusion;
+        std::array<std::array<CombFilter::State, NumCombFilters>, 2> combs;
+        std::array<Biquad::State, 2> highCut;
+        std::array<Biquad::State, 2> lowCut;
+        ModulationEngine::State modulation;
+        float decayEnvelope = 0.0f;
+    };
+
+    // Sizes a snapshot for the current configuration. Allocates, so call it
+    // off the audio thread after prepare(); save/restore are then allocation-free.
+    void prepareSnapshot(Snapshot& snapshot) const
+    {
+        snapshot.samples.assign(static_cast<size_t>(getSnapshotSize()), 0.0f);
+        snapshot.sampleRate = sampleRate;
+        snapshot.valid = false;
+    }
+
+    // Returns false if the snapshot was not prepared for the current configuration
+    bool saveSnapshot(Snapshot& snapshot) const
+    {
+        if (!isPreparedFor(snapshot))
+            return false;
+
+        float* dest = snapshot.samples.data();
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            std::copy(preDelayBuffer[ch].begin(), preDelayBuffer[ch].end(), dest);
+            dest += preDelayBuffer[ch].size();
+        }
+        snapshot.preDelayWriteIndex = preDelayWriteIndex;
+
+        snapshot.diffusion = diffusionNetwork.saveState(dest);
+        dest += diffusionNetwork.getStateSize();
+
+        for (size_t ch = 0; ch < 2; ++ch)
+        {
+            for (size_t i = 0; i < NumCombFilters; ++i)
+            {
+                snapshot.combs[ch][i] = combFilters[ch][i].saveState(dest);
+                dest += combFilters[ch][i].getStateSize();
+            }
+
+            snapshot.highCut[ch] = highCutFilter[ch].getState();
+            snapshot.lowCut[ch] = lowCutFilter[ch].getState();
+        }
+
+        snapshot.modulation = modulationEngine.getState();
+        snapshot.decayEnvelope = decayEnvelope;
+        snapshot.valid = true;
+        return true;
+    }
+
+    // Returns false (leaving the tank untouched) if the snapshot is empty or
+    // was taken with a different configuration
+    bool restoreSnapshot(const Snapshot& snapshot)
+    {
+        if (!snapshot.valid || !isPreparedFor(snapshot))
+            return false;
+
+        const float* src = snapshot.samples.data();
+
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            std::copy(src, src + preDelayBuffer[ch].size(), preDelayBuffer[ch].begin());
+            src += preDelayBuffer[ch].size();
+        }
+        preDelayWriteIndex = snapshot.preDelayWriteIndex;
+
+        diffusionNetwork.restoreState(snapshot.diffusion, src);
+        src += diffusionNetwork.getStateSize();
+
+        for (size_t ch = 0; ch < 2; ++ch)
+        {
+            for (size_t i = 0; i < NumCombFilters; ++i)
+            {
+                combFilters[ch][i].restoreState(snapshot.combs[ch][i], src);
+                src += combFilters[ch][i].getStateSize();
+            }
+
+            highCutFilter[ch].setState(snapshot.highCut[ch]);
+            lowCutFilter[ch].setState(snapshot.lowCut[ch]);
+        }
+
+        modulationEngine.setState(snapshot.modulation);
+        decayEnvelope = snapshot.decayEnvelope;
+        return true;
+    }
+
     // Get decay envelope value for visualization (0-1)
     float getDecayEnvelope() const { return decayEnvelope; }
 
+    // Get RMS of the tank output over the last block
+    float getTankEnergy() const { return tankEnergy; }
+
+    // Get the lowest and highest tank output sample over the last block
+    juce::Range<float> getTankRange() const { return tankRange; }
+
     void process(juce::AudioBuffer<float>& buffer)
     {
-        int numSamples = buffer.getNumSamples();
-        int numChannels = juce::jmin(buffer.getNumChannels(), 2);
+        process(AudioView::planar(buffer.getArrayOfWritePointers(),
+                                  juce::jmin(buffer.getNumChannels(), AudioView::MaxChannels),
+                                  buffer.getNumSamples()));
+    }
+
+    // High-resolution ticks spent in each stage during the last process() call
+    struct StageTicks
+    {
+        juce::int64 preDelay = 0;
+        juce::int64 diffusion = 0;
+        juce::int64 tank = 0;           // Comb filters and the modulation driving them
+        juce::int64 filters = 0;
+    };
 
-        // Create wet buffer
-        juce::AudioBuffer<float> wetBuffer(2, numSamples);
-        wetBuffer.clear();
+    const StageTicks& getStageTicks() const { return stageTicks; }
 
-        for (int sample = 0; sample < numSamples; ++sample)
+    // Processes a view of any length in place, one block at a time
+    void process(const AudioView& io)
+    {
+        stageTicks = {};
+
+        for (int start = 0; start < io.numSamples; start += blockSize)
+            processBlock(io.getSubView(start, juce::jmin(blockSize, io.numSamples - start)));
+    }
+
+private:
+    void processBlock(const AudioView& io)
+    {
+        int numSamples = io.numSamples;
+        int numChannels = io.numChannels;
+
+        // Non-owning view of the preallocated wet buffer, sized to this block
+        juce::AudioBuffer<float> wet(wetBuffer.getArrayOfWritePointers(), 2, numSamples);
+
+        auto lastTicks = juce::Time::getHighResolutionTicks();
+        auto addStageTicks = [&lastTicks](juce::int64& stage)
         {
-            // Update modulation engine
+            const auto now = juce::Time::getHighResolutionTicks();
+            stage += now - lastTicks;
+            lastTicks = now;
+        };
+
+        // Update modulation engine. It is independent of the audio, so it
+        // runs as its own loop and is timed with the tank that uses it.
+        for (int sample = 0; sample < numSamples; ++sample)
             modulationEngine.processSample();
 
+        addStageTicks(stageTicks.tank);
+
+        for (int sample = 0; sample < numSamples; ++sample)
+        {
             // Read from pre-delay
             int preDelayReadIndex = preDelayWriteIndex - preDelaySamples;
             if (preDelayReadIndex < 0)
                 preDelayReadIndex += static_cast<int>(preDelayBuffer[0].size());
 
-            float leftIn = (numChannels > 0) ? buffer.getSample(0, sample) : 0.0f;
-            float rightIn = (numChannels > 1) ? buffer.getSample(1, sample) : leftIn;
+            float leftIn = (numChannels > 0) ? io.at(0, sample) : 0.0f;
+            float rightIn = (numChannels > 1) ? io.at(1, sample) : leftIn;
 
             // Write to pre-delay
             preDelayBuffer[0][static_cast<size_t>(preDelayWriteIndex)] = leftIn;
@@ -179,19 +362,22 @@ public:
             float leftDelayed = preDelayBuffer[0][static_cast<size_t>(preDelayReadIndex)];
             float rightDelayed = preDelayBuffer[1][static_cast<size_t>(preDelayReadIndex)];
 
-            wetBuffer.setSample(0, sample, leftDelayed);
-            wetBuffer.setSample(1, sample, rightDelayed);
+            wet.setSample(0, sample, leftDelayed);
+            wet.setSample(1, sample, rightDelayed);
         }
 
+        addStageTicks(stageTicks.preDelay);
+
         // Apply diffusion network (Stage 1)
-        diffusionNetwork.process(wetBuffer);
+        diffusionNetwork.process(wet);
+        addStageTicks(stageTicks.diffusion);
 
         // Process through comb filter bank with modulation
         for (int sample = 0; sample < numSamples; ++sample)
         {
             for (int ch = 0; ch < 2; ++ch)
             {
-                float input = wetBuffer.getSample(ch, sample);
+                float input = wet.getSample(ch, sample);
                 float combSum = 0.0f;
 
                 // Sum outputs from all comb filters
@@ -209,51 +395,84 @@ public:
                     combSum += combOut * sign;
                 }
 
-                wetBuffer.setSample(ch, sample, combSum);
+                wet.setSample(ch, sample, combSum);
             }
         }
 
+        addStageTicks(stageTicks.tank);
+
         // Apply frequency-dependent damping
-        juce::dsp::AudioBlock<float> wetBlock(wetBuffer);
-        juce::dsp::ProcessContextReplacing<float> wetContext(wetBlock);
-        highCutFilter.process(wetContext);
-        lowCutFilter.process(wetContext);
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            highCutFilter[static_cast<size_t>(ch)].process(wet.getWritePointer(ch), numSamples);
+            lowCutFilter[static_cast<size_t>(ch)].process(wet.getWritePointer(ch), numSamples);
+        }
 
         // Apply stereo width
         if (std::abs(width - 1.0f) > 0.01f)
         {
             for (int sample = 0; sample < numSamples; ++sample)
             {
-                float left = wetBuffer.getSample(0, sample);
-                float right = wetBuffer.getSample(1, sample);
+                float left = wet.getSample(0, sample);
+                float right = wet.getSample(1, sample);
 
                 float mid = (left + right) * 0.5f;
                 float side = (left - right) * 0.5f * width;
 
-                wetBuffer.setSample(0, sample, mid + side);
-                wetBuffer.setSample(1, sample, mid - side);
+                wet.setSample(0, sample, mid + side);
+                wet.setSample(1, sample, mid - side);
             }
         }
 
-        // Update decay envelope for visualization
-        float maxSample = 0.0f;
-        for (int ch = 0; ch < wetBuffer.getNumChannels(); ++ch)
+        // Update decay envelope, tank range and energy for visualization
+        float sumSquares = 0.0f;
+        float lowest = 0.0f;
+        float highest = 0.0f;
+        for (int ch = 0; ch < wet.getNumChannels(); ++ch)
         {
             for (int sample = 0; sample < numSamples; ++sample)
             {
-                maxSample = juce::jmax(maxSample, std::abs(wetBuffer.getSample(ch, sample)));
+                const float value = wet.getSample(ch, sample);
+                lowest = juce::jmin(lowest, value);
+                highest = juce::jmax(highest, value);
+                sumSquares += value * value;
             }
         }
+        const float maxSample = juce::jmax(-lowest, highest);
+        tankRange = { lowest, highest };
         decayEnvelope = decayEnvelope * 0.99f + maxSample * 0.01f;
+        tankEnergy = numSamples > 0 ? std::sqrt(sumSquares / static_cast<float>(numSamples * wet.getNumChannels()))
+                                    : 0.0f;
 
-        // Copy wet signal back to buffer
+        // Copy wet signal back to the caller's memory
         for (int ch = 0; ch < numChannels; ++ch)
         {
-            buffer.copyFrom(ch, 0, wetBuffer, ch, 0, numSamples);
+            const float* src = wet.getReadPointer(ch);
+            for (int sample = 0; sample < numSamples; ++sample)
+                io.at(ch, sample) = src[sample];
         }
+
+        addStageTicks(stageTicks.filters);
+    }
+
+    int getSnapshotSize() const
+    {
+        int size = static_cast<int>(preDelayBuffer[0].size() + preDelayBuffer[1].size())
+                 + diffusionNetwork.getStateSize();
+
+        for (const auto& channel : combFilters)
+            for (const auto& comb : channel)
+                size += comb.getStateSize();
+
+        return size;
+    }
+
+    bool isPreparedFor(const Snapshot& snapshot) const
+    {
+        return snapshot.sampleRate == sampleRate
+            && snapshot.samples.size() == static_cast<size_t>(getSnapshotSize());
     }
 
-private:
     void updateDecay()
     {
         // Calculate feedback coefficient for desired RT60
@@ -286,18 +505,33 @@ private:
         }
     }
 
+    void updatePreDelay()
+    {
+        const int maxSamples = static_cast<int>(preDelayBuffer[0].size()) - 1;
+
+        preDelaySamples = maxSamples > 0 ? juce::jlimit(0, maxSamples,
+                                                        static_cast<int>(preDelayTime * sampleRate / 1000.0))
+                                         : 0;
+    }
+
     void updateFilters()
     {
-        *highCutFilter.state = *juce::dsp::IIR::Coefficients<float>::makeLowPass(
-            sampleRate, highCutFreq, 0.707f);
+        auto highCut = juce::dsp::IIR::Coefficients<float>::makeLowPass(sampleRate, highCutFreq, 0.707f);
+        auto lowCut = juce::dsp::IIR::Coefficients<float>::makeHighPass(sampleRate, lowCutFreq, 0.707f);
 
-        *lowCutFilter.state = *juce::dsp::IIR::Coefficients<float>::makeHighPass(
-            sampleRate, lowCutFreq, 0.707f);
+        for (int ch = 0; ch < 2; ++ch)
+        {
+            highCutFilter[static_cast<size_t>(ch)].setCoefficients(*highCut);
+            lowCutFilter[static_cast<size_t>(ch)].setCoefficients(*lowCut);
+        }
     }
 
     double sampleRate = 44100.0;
     int blockSize = 512;
 
+    // Wet signal of the block being processed, allocated in prepare()
+    juce::AudioBuffer<float> wetBuffer;
+
     // Pre-delay
     std::array<std::vector<float>, 2> preDelayBuffer;
     int preDelayWriteIndex = 0;
@@ -313,12 +547,11 @@ private:
     ModulationEngine modulationEngine;
 
     // Damping filters
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-                                   juce::dsp::IIR::Coefficients<float>> highCutFilter;
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-                                   juce::dsp::IIR::Coefficients<float>> lowCutFilter;
+    std::array<Biquad, 2> highCutFilter;
+    std::array<Biquad, 2> lowCutFilter;
 
     // Parameters
+    float preDelayTime = 0.0f;      // ms
     float decayTime = 5.0f;
     float highCutFreq = 12000.0f;
     float lowCutFreq = 80.0f;
@@ -326,6 +559,11 @@ private:
 
     // Visualization
     float decayEnvelope = 0.0f;
+    float tankEnergy = 0.0f;
+    juce::Range<float> tankRange;
+
+    // Instrumentation
+    StageTicks stageTicks;
 };
 
 } // namespace Cosmos
@@ -91,6 +91,28 @@ public:
         return output;
     }
 
+    //==========================================================================
+    // State snapshot: the delay line is copied to/from caller-owned storage of
+    // getStateSize() samples, so saving and restoring never allocate
+    struct State
+    {
+        int writeIndex = 0;
+    };
+
+    int getStateSize() const { return static_cast<int>(buffer.size()); }
+
+    State saveState(float* samples) const
+    {
+        std::copy(buffer.begin(), buffer.end(), samples);
+        return { writeIndex };
+    }
+
+    void restoreState(const State& state, const float* samples)
+    {
+        std::copy(samples, samples + buffer.size(), buffer.begin());
+        writeIndex = state.writeIndex;
+    }
+
 private:
     std::vector<float> buffer;
     int writeIndex = 0;
@@ -0,0 +1,3 @@
+#include "AudioView.h"
+
+// Implementation is inline in header for performance
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Non-owning view over 1 or 2 channels of float samples in caller memory
+ *
+ * Covers both interleaved frames (stride = number of channels) and separate
+ * channel arrays (stride = 1), so streaming callers can process their own
+ * ring buffers in place without deinterleaving into an AudioBuffer.
+ */
+struct AudioView
+{
+    static constexpr int MaxChannels = 2;
+
+    std::array<float*, MaxChannels> channels {};
+    int numChannels = 0;
+    int numSamples = 0;
+    int stride = 1;     // Distance between consecutive samples of one channel, in floats
+
+    static AudioView interleaved(float* data, int numChannelsInData, int numFrames)
+    {
+        jassert(numChannelsInData >= 1 && numChannelsInData <= MaxChannels);
+
+        AudioView view;
+        view.numChannels = juce::jlimit(0, MaxChannels, numChannelsInData);
+        view.numSamples = numFrames;
+        view.stride = numChannelsInData;
+
+        for (int ch = 0; ch < view.numChannels; ++ch)
+            view.channels[static_cast<size_t>(ch)] = data + ch;
+
+        return view;
+    }
+
+    static AudioView planar(float* const* channelData, int numChannelsInData, int numSamplesInData)
+    {
+        AudioView view;
+        view.numChannels = juce::jlimit(0, MaxChannels, numChannelsInData);
+        view.numSamples = numSamplesInData;
+
+        for (int ch = 0; ch < view.numChannels; ++ch)
+            view.channels[static_cast<size_t>(ch)] = channelData[ch];
+
+        return view;
+    }
+
+    // Samples [start, start + length) of this view
+    AudioView getSubView(int start, int length) const
+    {
+        jassert(start >= 0 && start + length <= numSamples);
+
+        AudioView view = *this;
+        view.numSamples = length;
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            view.channels[static_cast<size_t>(ch)] += static_cast<ptrdiff_t>(start) * stride;
+
+        return view;
+    }
+
+    float& at(int channel, int sample) const
+    {
+        return channels[static_cast<size_t>(channel)][static_cast<ptrdiff_t>(sample) * stride];
+    }
+};
+
+} // namespace Cosmos
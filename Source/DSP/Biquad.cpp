@@ -0,0 +1,3 @@
+#include "Biquad.h"
+
+// Implementation is inline in header for performance
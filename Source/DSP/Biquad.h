@@ -0,0 +1,73 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Mono second-order IIR section (transposed direct form II)
+ *
+ * Takes its coefficients from juce::dsp::IIR::Coefficients and computes the
+ * same response as juce::dsp::IIR::Filter, but exposes its two state
+ * variables so the tank can be snapshotted and restored exactly.
+ */
+class Biquad
+{
+public:
+    struct State
+    {
+        float s1 = 0.0f;
+        float s2 = 0.0f;
+    };
+
+    Biquad() = default;
+
+    void setCoefficients(const juce::dsp::IIR::Coefficients<float>& coefficients)
+    {
+        jassert(coefficients.getFilterOrder() == 2);
+
+        // Normalised layout: b0, b1, b2, a1, a2
+        const float* c = coefficients.getRawCoefficients();
+        b0 = c[0];
+        b1 = c[1];
+        b2 = c[2];
+        a1 = c[3];
+        a2 = c[4];
+    }
+
+    void reset()
+    {
+        state = {};
+    }
+
+    void process(float* data, int numSamples)
+    {
+        float s1 = state.s1;
+        float s2 = state.s2;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const float input = data[i];
+            const float output = b0 * input + s1;
+
+            s1 = b1 * input - a1 * output + s2;
+            s2 = b2 * input - a2 * output;
+            data[i] = output;
+        }
+
+        JUCE_SNAP_TO_ZERO(s1);
+        JUCE_SNAP_TO_ZERO(s2);
+        state = { s1, s2 };
+    }
+
+    State getState() const { return state; }
+    void setState(const State& newState) { state = newState; }
+
+private:
+    float b0 = 1.0f, b1 = 0.0f, b2 = 0.0f, a1 = 0.0f, a2 = 0.0f;
+    State state;
+};
+
+} // namespace Cosmos
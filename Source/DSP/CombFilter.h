@@ -101,6 +101,30 @@ public:
         return delayed;
     }
 
+    //==========================================================================
+    // State snapshot: the delay line is copied to/from caller-owned storage of
+    // getStateSize() samples, so saving and restoring never allocate
+    struct State
+    {
+        int writeIndex = 0;
+        float filterState = 0.0f;
+    };
+
+    int getStateSize() const { return static_cast<int>(buffer.size()); }
+
+    State saveState(float* samples) const
+    {
+        std::copy(buffer.begin(), buffer.end(), samples);
+        return { writeIndex, filterState };
+    }
+
+    void restoreState(const State& state, const float* samples)
+    {
+        std::copy(samples, samples + buffer.size(), buffer.begin());
+        writeIndex = state.writeIndex;
+        filterState = state.filterState;
+    }
+
 private:
     std::vector<float> buffer;
     int writeIndex = 0;
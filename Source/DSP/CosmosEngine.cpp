@@ -0,0 +1,3 @@
+#include "CosmosEngine.h"
+
+// Implementation is inline in header for performance
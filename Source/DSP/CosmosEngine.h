@@ -0,0 +1,237 @@
+#pragma once
+
+#include "AlgorithmicReverb.h"
+#include "../Utils/Parameters.h"
+#include <juce_dsp/juce_dsp.h>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Host-independent Cosmos processing chain
+ *
+ * Mirrors the signal path of CosmosAudioProcessor::processBlock
+ * (input gain -> reverb -> wet/dry mix -> output gain) so offline tools
+ * can run Cosmos without a plugin host.
+ *
+ * Fairing Separation is a live, tempo-triggered effect and is not part
+ * of the offline chain.
+ *
+ * Buffers of any length are processed in place, in chunks of at most the
+ * prepared block size, without allocating.
+ */
+class CosmosEngine
+{
+public:
+    // Bump whenever a DSP change alters rendered output; offline render
+    // caches key on it
+    static constexpr int Version = 1;
+
+    //==========================================================================
+    // Engine settings, in the same units as the plugin parameters
+    struct Settings
+    {
+        float decay = Defaults::decay;                      // seconds
+        float preDelay = Defaults::preDelay;                // ms
+        float highCut = Defaults::highCut;                  // Hz
+        float lowCut = Defaults::lowCut;                    // Hz
+        float mix = Defaults::mix;                          // percent
+        float width = Defaults::width;                      // percent
+        float diffusionThrust = Defaults::diffusionThrust;  // percent
+        float modulationChaos = Defaults::modulationChaos;  // percent
+        float inputGain = Defaults::inputGain;              // dB
+        float outputGain = Defaults::outputGain;            // dB
+
+        // Length of the tail after the input ends (pre-delay + decay)
+        double getTailLengthSeconds() const
+        {
+            return static_cast<double>(decay) + static_cast<double>(preDelay) / 1000.0;
+        }
+
+        // Settings of a nebula preset (mix and gains keep their defaults)
+        static Settings fromPreset(int presetIndex)
+        {
+            const auto& preset = NebulaPresets::getPreset(presetIndex);
+
+            Settings s;
+            s.decay = preset.decay;
+            s.preDelay = preset.preDelay;
+            s.highCut = preset.highCut;
+            s.lowCut = preset.lowCut;
+            s.width = preset.width;
+            s.diffusionThrust = preset.diffusion;
+            s.modulationChaos = preset.chaos;
+            return s;
+        }
+    };
+
+    CosmosEngine() = default;
+
+    void prepare(double sr, int maxBlockSizeToUse)
+    {
+        sampleRate = sr;
+        maxBlockSize = juce::jmax(1, maxBlockSizeToUse);
+
+        reverb.prepare(sampleRate, maxBlockSize);
+        dryBuffer.setSize(2, maxBlockSize);
+
+        smoothedMix.reset(sampleRate, 0.05);
+        smoothedInputGain.reset(sampleRate, 0.02);
+        smoothedOutputGain.reset(sampleRate, 0.02);
+
+        applySettings(true);
+    }
+
+    void reset()
+    {
+        reverb.reset();
+        applySettings(true);
+    }
+
+    // May be called before prepare(). Settings in place when prepare() or
+    // reset() runs apply at once; later changes ramp the mix and gains.
+    void setSettings(const Settings& newSettings)
+    {
+        settings = newSettings;
+        applySettings(false);
+    }
+
+    const Settings& getSettings() const { return settings; }
+
+    // Deterministic modulation: the output becomes a pure function of the
+    // input, the settings and the seed, and any sample position can be
+    // addressed with setPosition(). Call after prepare()/reset().
+    void setSeed(juce::uint32 newSeed)
+    {
+        reverb.setModulationSeed(newSeed);
+    }
+
+    void setPosition(juce::int64 samplePosition)
+    {
+        reverb.setModulationPosition(samplePosition);
+    }
+
+    // Length of the tail after the input ends (pre-delay + decay)
+    double getTailLengthSeconds() const { return settings.getTailLengthSeconds(); }
+
+    // Tank state capture, see AlgorithmicReverb::Snapshot. The mix and gain
+    // smoothers are not captured; they are settled whenever settings are constant.
+    using Snapshot = AlgorithmicReverb::Snapshot;
+
+    void prepareSnapshot(Snapshot& snapshot) const { reverb.prepareSnapshot(snapshot); }
+    bool saveSnapshot(Snapshot& snapshot) const { return reverb.saveSnapshot(snapshot); }
+    bool restoreSnapshot(const Snapshot& snapshot) { return reverb.restoreSnapshot(snapshot); }
+
+    // Processes a stereo buffer in place
+    void process(juce::AudioBuffer<float>& buffer)
+    {
+        process(AudioView::planar(buffer.getArrayOfWritePointers(),
+                                  juce::jmin(buffer.getNumChannels(), AudioView::MaxChannels),
+                                  buffer.getNumSamples()));
+    }
+
+    // Processes interleaved or planar caller memory of any length in place
+    void process(const AudioView& io)
+    {
+        for (int start = 0; start < io.numSamples; start += maxBlockSize)
+            processBlock(io.getSubView(start, juce::jmin(maxBlockSize, io.numSamples - start)));
+    }
+
+private:
+    void processBlock(const AudioView& io)
+    {
+        const int numSamples = io.numSamples;
+        const int numChannels = io.numChannels;
+
+        // Input gain, keeping the gained input as the dry signal
+        const auto inputGain = getRamp(smoothedInputGain, numSamples);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            float* dry = dryBuffer.getWritePointer(ch);
+            float gain = inputGain.start;
+
+            for (int i = 0; i < numSamples; ++i, gain += inputGain.increment)
+            {
+                float& sample = io.at(ch, i);
+                sample *= gain;
+                dry[i] = sample;
+            }
+        }
+
+        reverb.process(io);
+
+        // Wet/dry mix and output gain in one pass
+        const auto mix = getRamp(smoothedMix, numSamples);
+        const auto outputGain = getRamp(smoothedOutputGain, numSamples);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const float* dry = dryBuffer.getReadPointer(ch);
+            float wetGain = mix.start;
+            float gain = outputGain.start;
+
+            for (int i = 0; i < numSamples; ++i, wetGain += mix.increment, gain += outputGain.increment)
+            {
+                float& sample = io.at(ch, i);
+                sample = (sample * wetGain + dry[i] * (1.0f - wetGain)) * gain;
+            }
+        }
+    }
+
+    void applySettings(bool snapSmoothers)
+    {
+        reverb.setDecay(settings.decay);
+        reverb.setPreDelay(settings.preDelay);
+        reverb.setHighCut(settings.highCut);
+        reverb.setLowCut(settings.lowCut);
+        reverb.setWidth(settings.width / 100.0f);
+        reverb.setDiffusionThrust(settings.diffusionThrust / 100.0f);
+        reverb.setModulationChaos(settings.modulationChaos / 100.0f);
+
+        const float mix = settings.mix / 100.0f;
+        const float inputGain = juce::Decibels::decibelsToGain(settings.inputGain);
+        const float outputGain = juce::Decibels::decibelsToGain(settings.outputGain);
+
+        if (snapSmoothers)
+        {
+            smoothedMix.setCurrentAndTargetValue(mix);
+            smoothedInputGain.setCurrentAndTargetValue(inputGain);
+            smoothedOutputGain.setCurrentAndTargetValue(outputGain);
+        }
+        else
+        {
+            smoothedMix.setTargetValue(mix);
+            smoothedInputGain.setTargetValue(inputGain);
+            smoothedOutputGain.setTargetValue(outputGain);
+        }
+    }
+
+    // Linear per-sample ramp of a smoothed value across one block
+    struct Ramp
+    {
+        float start;
+        float increment;
+    };
+
+    static Ramp getRamp(juce::SmoothedValue<float>& value, int numSamples)
+    {
+        const float start = value.getCurrentValue();
+        value.skip(numSamples);
+        return { start, (value.getCurrentValue() - start) / static_cast<float>(juce::jmax(1, numSamples)) };
+    }
+
+    double sampleRate = 44100.0;
+    int maxBlockSize = 512;
+    Settings settings;
+
+    AlgorithmicReverb reverb;
+    juce::AudioBuffer<float> dryBuffer;
+
+    juce::SmoothedValue<float> smoothedMix;
+    juce::SmoothedValue<float> smoothedInputGain;
+    juce::SmoothedValue<float> smoothedOutputGain;
+};
+
+} // namespace Cosmos
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "AllpassFilter.h"
+#include "Biquad.h"
 #include <juce_dsp/juce_dsp.h>
 #include <array>
 
@@ -46,12 +47,11 @@ public:
         }
 
         // Low-mid emphasis filter (shelf boost around 200-800Hz)
-        juce::dsp::ProcessSpec spec;
-        spec.sampleRate = sampleRate;
-        spec.maximumBlockSize = static_cast<juce::uint32>(maxBlockSize);
-        spec.numChannels = NumChannels;
+        juce::ignoreUnused(maxBlockSize);
+
+        for (auto& filter : lowMidFilter)
+            filter.reset();
 
-        lowMidFilter.prepare(spec);
         updateThrustFilter();
     }
 
@@ -64,7 +64,9 @@ public:
                 allpassFilters[static_cast<size_t>(ch)][static_cast<size_t>(i)].reset();
             }
         }
-        lowMidFilter.reset();
+
+        for (auto& filter : lowMidFilter)
+            filter.reset();
     }
 
     // Set diffusion thrust amount (0-1)
@@ -124,9 +126,58 @@ public:
         // Apply low-mid emphasis filter when thrust is engaged
         if (thrustAmount > 0.01f)
         {
-            juce::dsp::AudioBlock<float> block(buffer);
-            juce::dsp::ProcessContextReplacing<float> context(block);
-            lowMidFilter.process(context);
+            for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), NumChannels); ++ch)
+                lowMidFilter[static_cast<size_t>(ch)].process(buffer.getWritePointer(ch), numSamples);
+        }
+    }
+
+    //==========================================================================
+    // State snapshot: allpass delay lines go to/from caller-owned storage of
+    // getStateSize() samples, so saving and restoring never allocate
+    struct State
+    {
+        std::array<std::array<AllpassFilter::State, NumStages>, NumChannels> allpass;
+        std::array<Biquad::State, NumChannels> lowMid;
+    };
+
+    int getStateSize() const
+    {
+        int size = 0;
+        for (const auto& channel : allpassFilters)
+            for (const auto& filter : channel)
+                size += filter.getStateSize();
+        return size;
+    }
+
+    State saveState(float* samples) const
+    {
+        State state;
+
+        for (size_t ch = 0; ch < NumChannels; ++ch)
+        {
+            for (size_t i = 0; i < NumStages; ++i)
+            {
+                state.allpass[ch][i] = allpassFilters[ch][i].saveState(samples);
+                samples += allpassFilters[ch][i].getStateSize();
+            }
+
+            state.lowMid[ch] = lowMidFilter[ch].getState();
+        }
+
+        return state;
+    }
+
+    void restoreState(const State& state, const float* samples)
+    {
+        for (size_t ch = 0; ch < NumChannels; ++ch)
+        {
+            for (size_t i = 0; i < NumStages; ++i)
+            {
+                allpassFilters[ch][i].restoreState(state.allpass[ch][i], samples);
+                samples += allpassFilters[ch][i].getStateSize();
+            }
+
+            lowMidFilter[ch].setState(state.lowMid[ch]);
         }
     }
 
@@ -136,17 +187,19 @@ private:
         // Low shelf boost for "thrust" effect - emphasizes 200-800Hz range
         float boostDb = thrustAmount * 6.0f; // 0 to 6dB boost
 
-        *lowMidFilter.state = *juce::dsp::IIR::Coefficients<float>::makeLowShelf(
+        auto coefficients = juce::dsp::IIR::Coefficients<float>::makeLowShelf(
             sampleRate,
             400.0f,     // Shelf frequency
             0.7f,       // Q
             juce::Decibels::decibelsToGain(boostDb)
         );
+
+        for (auto& filter : lowMidFilter)
+            filter.setCoefficients(*coefficients);
     }
 
     std::array<std::array<AllpassFilter, NumStages>, NumChannels> allpassFilters;
-    juce::dsp::ProcessorDuplicator<juce::dsp::IIR::Filter<float>,
-                                   juce::dsp::IIR::Coefficients<float>> lowMidFilter;
+    std::array<Biquad, NumChannels> lowMidFilter;
 
     double sampleRate = 44100.0;
     float thrustAmount = 0.5f;
@@ -94,6 +94,9 @@ public:
     // Get current effect intensity for visualization (0-1)
     float getIntensity() const { return gainEnvelope; }
 
+    // Get progress through the effect (0-1)
+    float getPhase() const { return currentPhase; }
+
     void process(juce::AudioBuffer<float>& buffer)
     {
         if (!isActive && gainEnvelope < 0.001f)
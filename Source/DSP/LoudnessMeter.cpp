@@ -0,0 +1,3 @@
+#include "LoudnessMeter.h"
+
+// Implementation is inline in header for performance
@@ -0,0 +1,360 @@
+#pragma once
+
+#include <juce_dsp/juce_dsp.h>
+#include "Biquad.h"
+#include <array>
+#include <vector>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define COSMOS_METER_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+ #include <arm_neon.h>
+ #define COSMOS_METER_NEON 1
+#endif
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Output meter: sample peak, RMS, true peak and ITU-R BS.1770 loudness
+ *
+ * - Peak and RMS per block, from one SSE2/NEON pass over each channel.
+ * - True peak per block from 4x polyphase interpolation (BS.1770-4 Annex 2
+ *   structure; 48-tap windowed-sinc), the four phases computed in one
+ *   vector register.
+ * - K-weighted loudness in 100 ms steps: momentary (400 ms) and short-term
+ *   (3 s), ungated, in LUFS.
+ *
+ * Allocation happens in prepare() only; process() is real-time safe.
+ */
+class LoudnessMeter
+{
+public:
+    static constexpr int MaxChannels = 2;
+    static constexpr int OversampleFactor = 4;
+    static constexpr int TapsPerPhase = 12;
+    static constexpr int MomentaryBlocks = 4;     // 400 ms
+    static constexpr int ShortTermBlocks = 30;    // 3 s
+    static constexpr float MinLoudness = -70.0f;  // BS.1770 absolute gate
+
+    struct Levels
+    {
+        std::array<float, MaxChannels> peak {};
+        std::array<float, MaxChannels> rms {};
+        std::array<float, MaxChannels> truePeak {};
+        float momentaryLufs = MinLoudness;
+        float shortTermLufs = MinLoudness;
+    };
+
+    LoudnessMeter() = default;
+
+    void prepare(double sampleRate, int maxBlockSize)
+    {
+        subBlockLength = juce::jmax(1, juce::roundToInt(sampleRate * 0.1));
+
+        for (auto& channel : channels)
+        {
+            channel.weighted.assign(static_cast<size_t>(maxBlockSize), 0.0f);
+            channel.history.assign(static_cast<size_t>(maxBlockSize + TapsPerPhase - 1), 0.0f);
+            channel.shelf.setCoefficients(makeShelfCoefficients(sampleRate));
+            channel.highPass.setCoefficients(makeHighPassCoefficients(sampleRate));
+        }
+
+        // Polyphase taps, laid out [tap][phase] so one vector holds all phases.
+        // Centred on a whole input sample, so the phases interpolate at 0, 1/4,
+        // 1/2 and 3/4 of a sample.
+        constexpr int numTaps = TapsPerPhase * OversampleFactor;
+        constexpr int centre = numTaps / 2;
+
+        for (int n = 0; n < numTaps; ++n)
+        {
+            const double t = static_cast<double>(n - centre) / OversampleFactor;
+            const double sinc = n == centre ? 1.0 : std::sin(juce::MathConstants<double>::pi * t)
+                                                    / (juce::MathConstants<double>::pi * t);
+            const double window = 0.5 + 0.5 * std::cos(juce::MathConstants<double>::pi * (n - centre) / centre);
+
+            polyphase[static_cast<size_t>(n)] = static_cast<float>(sinc * window);
+        }
+
+        reset();
+    }
+
+    void reset()
+    {
+        for (auto& channel : channels)
+        {
+            channel.shelf.reset();
+            channel.highPass.reset();
+            std::fill(channel.history.begin(), channel.history.end(), 0.0f);
+        }
+
+        subBlockEnergy.fill(0.0f);
+        subBlockIndex = 0;
+        numSubBlocks = 0;
+        subBlockSquares = 0.0;
+        subBlockCount = 0;
+        levels = {};
+    }
+
+    // Measures one block of output (1 or 2 channels). Blocks longer than the
+    // prepared size are measured in prepared-size pieces.
+    void process(const float* const* data, int numChannels, int numSamples)
+    {
+        numChannels = juce::jmin(numChannels, MaxChannels);
+        levels.peak = {};
+        levels.rms = {};
+        levels.truePeak = {};
+
+        const int maxChunk = static_cast<int>(channels[0].weighted.size());
+        if (maxChunk == 0)
+            return;
+
+        std::array<float, MaxChannels> sumSquares {};
+
+        for (int offset = 0; offset < numSamples; offset += maxChunk)
+        {
+            const int chunk = juce::jmin(maxChunk, numSamples - offset);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                const auto index = static_cast<size_t>(ch);
+                sumSquares[index] += processChannel(channels[index], data[ch] + offset, chunk,
+                                                    levels.peak[index], levels.truePeak[index]);
+            }
+
+            accumulateLoudness(numChannels, chunk);
+        }
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            const auto index = static_cast<size_t>(ch);
+            levels.rms[index] = numSamples > 0 ? std::sqrt(sumSquares[index] / static_cast<float>(numSamples)) : 0.0f;
+        }
+    }
+
+    const Levels& getLevels() const { return levels; }
+
+    // Sum of squares and absolute peak of a block, four samples at a time
+    static float measure(const float* data, int numSamples, float& peak)
+    {
+        int i = 0;
+        float sum = 0.0f;
+        float maxAbs = 0.0f;
+
+       #if COSMOS_METER_SSE2
+        const __m128 signMask = _mm_set1_ps(-0.0f);
+        __m128 sumV = _mm_setzero_ps();
+        __m128 maxV = _mm_setzero_ps();
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m128 x = _mm_loadu_ps(data + i);
+            sumV = _mm_add_ps(sumV, _mm_mul_ps(x, x));
+            maxV = _mm_max_ps(maxV, _mm_andnot_ps(signMask, x));
+        }
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, sumV);
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+        _mm_store_ps(lanes, maxV);
+        maxAbs = juce::jmax(juce::jmax(lanes[0], lanes[1]), juce::jmax(lanes[2], lanes[3]));
+       #elif COSMOS_METER_NEON
+        float32x4_t sumV = vdupq_n_f32(0.0f);
+        float32x4_t maxV = vdupq_n_f32(0.0f);
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const float32x4_t x = vld1q_f32(data + i);
+            sumV = vmlaq_f32(sumV, x, x);
+            maxV = vmaxq_f32(maxV, vabsq_f32(x));
+        }
+
+        sum = vaddvq_f32(sumV);
+        maxAbs = vmaxvq_f32(maxV);
+       #endif
+
+        for (; i < numSamples; ++i)
+        {
+            sum += data[i] * data[i];
+            maxAbs = juce::jmax(maxAbs, std::abs(data[i]));
+        }
+
+        peak = maxAbs;
+        return sum;
+    }
+
+private:
+    struct Channel
+    {
+        Biquad shelf;
+        Biquad highPass;
+        std::vector<float> weighted;
+        std::vector<float> history;     // TapsPerPhase - 1 previous samples, then the block
+    };
+
+    // BS.1770 pre-filter (high shelf), re-derived for any sample rate
+    static juce::dsp::IIR::Coefficients<float> makeShelfCoefficients(double sampleRate)
+    {
+        const double f0 = 1681.974450955533;
+        const double gainDb = 3.999843853973347;
+        const double q = 0.7071752369554196;
+
+        const double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        const double vh = std::pow(10.0, gainDb / 20.0);
+        const double vb = std::pow(vh, 0.4996667741545416);
+
+        return juce::dsp::IIR::Coefficients<float>(
+            static_cast<float>(vh + vb * k / q + k * k),
+            static_cast<float>(2.0 * (k * k - vh)),
+            static_cast<float>(vh - vb * k / q + k * k),
+            static_cast<float>(1.0 + k / q + k * k),
+            static_cast<float>(2.0 * (k * k - 1.0)),
+            static_cast<float>(1.0 - k / q + k * k));
+    }
+
+    // BS.1770 RLB weighting (high pass)
+    static juce::dsp::IIR::Coefficients<float> makeHighPassCoefficients(double sampleRate)
+    {
+        const double f0 = 38.13547087602444;
+        const double q = 0.5003270373238773;
+
+        const double k = std::tan(juce::MathConstants<double>::pi * f0 / sampleRate);
+        const double a0 = 1.0 + k / q + k * k;
+
+        // The numerator is 1, -2, 1 after normalisation, as in the standard
+        return juce::dsp::IIR::Coefficients<float>(
+            static_cast<float>(a0), static_cast<float>(-2.0 * a0), static_cast<float>(a0),
+            static_cast<float>(a0),
+            static_cast<float>(2.0 * (k * k - 1.0)),
+            static_cast<float>(1.0 - k / q + k * k));
+    }
+
+    // Peak, true peak and K-weighting of one chunk; returns its sum of squares
+    float processChannel(Channel& channel, const float* data, int numSamples, float& peak, float& truePeak)
+    {
+        float chunkPeak = 0.0f;
+        const float sumSquares = measure(data, numSamples, chunkPeak);
+        peak = juce::jmax(peak, chunkPeak);
+        truePeak = juce::jmax(truePeak, chunkPeak, measureTruePeak(channel, data, numSamples));
+
+        std::copy(data, data + numSamples, channel.weighted.begin());
+        channel.shelf.process(channel.weighted.data(), numSamples);
+        channel.highPass.process(channel.weighted.data(), numSamples);
+        return sumSquares;
+    }
+
+    // Accumulates K-weighted energy (channel weights are 1 for L/R) in 100 ms steps
+    void accumulateLoudness(int numChannels, int numSamples)
+    {
+        for (int start = 0; start < numSamples;)
+        {
+            const int length = juce::jmin(numSamples - start, subBlockLength - subBlockCount);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                float ignoredPeak = 0.0f;
+                subBlockSquares += measure(channels[static_cast<size_t>(ch)].weighted.data() + start,
+                                           length, ignoredPeak);
+            }
+
+            subBlockCount += length;
+            start += length;
+
+            if (subBlockCount == subBlockLength)
+                finishSubBlock();
+        }
+    }
+
+    float measureTruePeak(Channel& channel, const float* data, int numSamples)
+    {
+        constexpr int historyLength = TapsPerPhase - 1;
+        float* x = channel.history.data();
+
+        std::copy(data, data + numSamples, x + historyLength);
+
+        float maxAbs = 0.0f;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            // x[i + historyLength] is the newest input; taps run back in time
+            const float* newest = x + i + historyLength;
+
+           #if COSMOS_METER_SSE2
+            __m128 acc = _mm_setzero_ps();
+            for (int k = 0; k < TapsPerPhase; ++k)
+                acc = _mm_add_ps(acc, _mm_mul_ps(_mm_set1_ps(newest[-k]),
+                                                 _mm_loadu_ps(polyphase.data() + k * OversampleFactor)));
+
+            alignas(16) float phases[OversampleFactor];
+            _mm_store_ps(phases, _mm_andnot_ps(_mm_set1_ps(-0.0f), acc));
+           #elif COSMOS_METER_NEON
+            float32x4_t acc = vdupq_n_f32(0.0f);
+            for (int k = 0; k < TapsPerPhase; ++k)
+                acc = vmlaq_n_f32(acc, vld1q_f32(polyphase.data() + k * OversampleFactor), newest[-k]);
+
+            float phases[OversampleFactor];
+            vst1q_f32(phases, vabsq_f32(acc));
+           #else
+            float phases[OversampleFactor] = {};
+            for (int k = 0; k < TapsPerPhase; ++k)
+                for (int p = 0; p < OversampleFactor; ++p)
+                    phases[p] += newest[-k] * polyphase[static_cast<size_t>(k * OversampleFactor + p)];
+
+            for (auto& phase : phases)
+                phase = std::abs(phase);
+           #endif
+
+            for (float phase : phases)
+                maxAbs = juce::jmax(maxAbs, phase);
+        }
+
+        // Keep the last samples as history for the next block
+        std::copy(x + numSamples, x + numSamples + historyLength, x);
+        return maxAbs;
+    }
+
+    void finishSubBlock()
+    {
+        subBlockEnergy[static_cast<size_t>(subBlockIndex)] = static_cast<float>(subBlockSquares / subBlockLength);
+        subBlockIndex = (subBlockIndex + 1) % ShortTermBlocks;
+        numSubBlocks = juce::jmin(numSubBlocks + 1, ShortTermBlocks);
+        subBlockSquares = 0.0;
+        subBlockCount = 0;
+
+        levels.momentaryLufs = toLufs(meanEnergy(MomentaryBlocks));
+        levels.shortTermLufs = toLufs(meanEnergy(ShortTermBlocks));
+    }
+
+    // Mean energy of the last count sub-blocks (fewer until the meter has run that long)
+    float meanEnergy(int count) const
+    {
+        count = juce::jmin(count, numSubBlocks);
+        float sum = 0.0f;
+
+        for (int i = 1; i <= count; ++i)
+            sum += subBlockEnergy[static_cast<size_t>((subBlockIndex - i + ShortTermBlocks) % ShortTermBlocks)];
+
+        return count > 0 ? sum / static_cast<float>(count) : 0.0f;
+    }
+
+    static float toLufs(float energy)
+    {
+        return energy > 0.0f ? juce::jmax(MinLoudness, -0.691f + 10.0f * std::log10(energy)) : MinLoudness;
+    }
+
+    std::array<Channel, MaxChannels> channels;
+    std::array<float, TapsPerPhase * OversampleFactor> polyphase {};
+
+    int subBlockLength = 4800;
+    int subBlockCount = 0;
+    double subBlockSquares = 0.0;
+    std::array<float, ShortTermBlocks> subBlockEnergy {};
+    int subBlockIndex = 0;
+    int numSubBlocks = 0;
+
+    Levels levels;
+};
+
+} // namespace Cosmos
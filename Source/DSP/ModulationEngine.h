@@ -29,6 +29,7 @@ public:
     void prepare(double sr)
     {
         sampleRate = sr;
+        driftPeriod = static_cast<int>(sampleRate * 2.0) + 1;
 
         // Initialize LFOs with golden ratio-based frequency relationships
         // These irrational ratios prevent periodic repetition
@@ -56,10 +57,19 @@ public:
         }
 
         updateDriftTargets();
+
+        if (deterministic)
+            setPosition(0);
     }
 
     void reset()
     {
+        if (deterministic)
+        {
+            setPosition(0);
+            return;
+        }
+
         for (int i = 0; i < NumLFOs; ++i)
         {
             lfoPhases[static_cast<size_t>(i)] = static_cast<float>(i) * 0.37f;
@@ -93,6 +103,96 @@ public:
         maxDepthSamples = 20.0f + chaosAmount * 60.0f; // 20 to 80 samples max deviation
     }
 
+    //==========================================================================
+    // Deterministic mode
+    //
+    // With a seed set, initial phases and drift targets are derived from the
+    // seed instead of std::random_device, and the modulation state becomes a
+    // function of the absolute sample position. setPosition() can then jump
+    // straight to any point of a render, which is what lets offline tools
+    // render segments of one file in parallel and still match a serial render.
+    // Phases are re-anchored to the position every ResyncInterval samples so
+    // serial and segmented renders do not drift apart over long files.
+    // Assumes the chaos setting stays constant for the whole render.
+    //==========================================================================
+    static constexpr int ResyncInterval = 1024;
+
+    void setSeed(juce::uint32 newSeed)
+    {
+        deterministic = true;
+        seed = newSeed;
+        setPosition(0);
+    }
+
+    bool isDeterministic() const { return deterministic; }
+    juce::uint32 getSeed() const { return seed; }
+    juce::int64 getPosition() const { return samplePosition; }
+
+    // Jumps to an absolute sample position (deterministic mode only)
+    void setPosition(juce::int64 position)
+    {
+        jassert(deterministic);
+
+        samplePosition = juce::jmax(static_cast<juce::int64>(0), position);
+        resyncPhases();
+
+        // Replay the drift one-pole in closed form, one drift period at a time
+        const double driftSmooth = 0.9999;
+        const juce::int64 epoch = samplePosition / driftPeriod;
+
+        for (int out = 0; out < NumOutputs; ++out)
+        {
+            double value = 0.0;
+
+            for (juce::int64 e = 0; e <= epoch; ++e)
+            {
+                const juce::int64 first = juce::jmax(static_cast<juce::int64>(1), e * driftPeriod);
+                const juce::int64 last = juce::jmin(samplePosition, (e + 1) * driftPeriod - 1);
+                const double target = seededDriftTarget(e, out);
+
+                if (last >= first)
+                    value = target + (value - target) * std::pow(driftSmooth, static_cast<double>(last - first + 1));
+            }
+
+            driftValues[static_cast<size_t>(out)] = static_cast<float>(value);
+            driftTargets[static_cast<size_t>(out)] = seededDriftTarget(epoch, out);
+        }
+
+        driftCounter = static_cast<int>(samplePosition % driftPeriod);
+
+        // Start the output smoothers settled rather than ramping up from zero
+        for (int out = 0; out < NumOutputs; ++out)
+            smoothedOutputs[static_cast<size_t>(out)] = computeModulation(out);
+    }
+
+    //==========================================================================
+    // State snapshot (everything that evolves per sample; rates and depth
+    // follow from the chaos setting)
+    struct State
+    {
+        std::array<float, NumLFOs> lfoPhases {};
+        std::array<float, NumOutputs> driftValues {};
+        std::array<float, NumOutputs> driftTargets {};
+        std::array<float, NumOutputs> smoothedOutputs {};
+        int driftCounter = 0;
+        juce::int64 samplePosition = 0;
+    };
+
+    State getState() const
+    {
+        return { lfoPhases, driftValues, driftTargets, smoothedOutputs, driftCounter, samplePosition };
+    }
+
+    void setState(const State& state)
+    {
+        lfoPhases = state.lfoPhases;
+        driftValues = state.driftValues;
+        driftTargets = state.driftTargets;
+        smoothedOutputs = state.smoothedOutputs;
+        driftCounter = state.driftCounter;
+        samplePosition = state.samplePosition;
+    }
+
     // Get modulation offset for a specific delay line (in samples)
     float getModulation(int outputIndex) const
     {
@@ -116,11 +216,28 @@ public:
                 lfoPhases[static_cast<size_t>(i)] -= juce::MathConstants<float>::twoPi;
         }
 
+        if (deterministic)
+        {
+            ++samplePosition;
+
+            if (samplePosition % ResyncInterval == 0)
+                resyncPhases();
+        }
+
         // Update drift (very slow random walk)
         driftCounter++;
-        if (driftCounter > static_cast<int>(sampleRate * 2.0)) // Update every 2 seconds
+        if (driftCounter >= driftPeriod) // Update every 2 seconds
         {
-            updateDriftTargets();
+            if (deterministic)
+            {
+                for (int i = 0; i < NumOutputs; ++i)
+                    driftTargets[static_cast<size_t>(i)] = seededDriftTarget(samplePosition / driftPeriod, i);
+            }
+            else
+            {
+                updateDriftTargets();
+            }
+
             driftCounter = 0;
         }
 
@@ -136,24 +253,7 @@ public:
         // Each output uses a unique combination for maximum decorrelation
         for (int out = 0; out < NumOutputs; ++out)
         {
-            float modValue = 0.0f;
-
-            // Mix multiple LFOs with different weights
-            for (int lfo = 0; lfo < NumLFOs; ++lfo)
-            {
-                // Create unique mixing matrix using prime-based weights
-                float weight = getMixWeight(out, lfo);
-
-                // Use different wave shapes for different LFOs
-                float lfoValue = getLFOValue(lfo);
-                modValue += lfoValue * weight;
-            }
-
-            // Add drift component for extra complexity at high chaos
-            modValue += driftValues[static_cast<size_t>(out)] * chaosAmount * 0.3f;
-
-            // Scale to sample range
-            modValue *= maxDepthSamples;
+            float modValue = computeModulation(out);
 
             // Smooth output to prevent clicks
             float smoothCoeff = 0.995f;
@@ -163,6 +263,65 @@ public:
     }
 
 private:
+    float computeModulation(int out) const
+    {
+        float modValue = 0.0f;
+
+        // Mix multiple LFOs with different weights
+        for (int lfo = 0; lfo < NumLFOs; ++lfo)
+        {
+            // Create unique mixing matrix using prime-based weights
+            float weight = getMixWeight(out, lfo);
+
+            // Use different wave shapes for different LFOs
+            float lfoValue = getLFOValue(lfo);
+            modValue += lfoValue * weight;
+        }
+
+        // Add drift component for extra complexity at high chaos
+        modValue += driftValues[static_cast<size_t>(out)] * chaosAmount * 0.3f;
+
+        // Scale to sample range
+        return modValue * maxDepthSamples;
+    }
+
+    // Recomputes LFO phases from the absolute sample position (deterministic mode)
+    void resyncPhases()
+    {
+        const double twoPi = juce::MathConstants<double>::twoPi;
+
+        for (int i = 0; i < NumLFOs; ++i)
+        {
+            const double cycles = static_cast<double>(lfoFrequencies[static_cast<size_t>(i)])
+                                * static_cast<double>(samplePosition) / sampleRate;
+            const double phase = seededInitialPhase(i) + twoPi * (cycles - std::floor(cycles));
+            lfoPhases[static_cast<size_t>(i)] = static_cast<float>(std::fmod(phase, twoPi));
+        }
+    }
+
+    double seededInitialPhase(int lfoIndex) const
+    {
+        return static_cast<double>(lfoIndex) * 0.37
+             + hashToUnit(seed, static_cast<juce::uint64>(lfoIndex), 0x9e37u) * juce::MathConstants<double>::twoPi * 0.3;
+    }
+
+    float seededDriftTarget(juce::int64 epoch, int outputIndex) const
+    {
+        const auto key = (static_cast<juce::uint64>(epoch) << 4) | static_cast<juce::uint64>(outputIndex);
+        return static_cast<float>(hashToUnit(seed, key, 0xd71fu) * 2.0 - 1.0);
+    }
+
+    // Stateless hash of (seed, key, salt) to [0, 1), so any position can be addressed directly
+    static double hashToUnit(juce::uint32 seedValue, juce::uint64 key, juce::uint32 salt)
+    {
+        juce::uint64 x = key ^ (static_cast<juce::uint64>(seedValue) << 32) ^ salt;
+        x += 0x9e3779b97f4a7c15ull;
+        x = (x ^ (x >> 30)) * 0xbf58476d1ce4e5b9ull;
+        x = (x ^ (x >> 27)) * 0x94d049bb133111ebull;
+        x ^= x >> 31;
+        return static_cast<double>(x >> 11) * (1.0 / 9007199254740992.0);
+    }
+
     float getLFOValue(int lfoIndex) const
     {
         float phase = lfoPhases[static_cast<size_t>(lfoIndex)];
@@ -236,6 +395,12 @@ private:
     std::array<float, NumOutputs> smoothedOutputs = {};
 
     int driftCounter = 0;
+    int driftPeriod = 88201;
+
+    // Deterministic mode
+    bool deterministic = false;
+    juce::uint32 seed = 0;
+    juce::int64 samplePosition = 0;
 };
 
 } // namespace Cosmos
@@ -20,6 +20,12 @@ CosmosAudioProcessorEditor::CosmosAudioProcessorEditor(CosmosAudioProcessor& p)
     // Add decay curve display
     addAndMakeVisible(decayCurve);
 
+    // Add spectrum analyzer
+    addAndMakeVisible(spectrum);
+
+    // Add CPU meter
+    addAndMakeVisible(cpuMeter);
+
     // Setup components
     setupKnobs();
     setupLabels();
@@ -27,18 +33,42 @@ CosmosAudioProcessorEditor::CosmosAudioProcessorEditor(CosmosAudioProcessor& p)
     setupNebulaSelector();
     attachParameters();
 
+    // Static controls are cached as images and only re-rendered when they
+    // change; the starfield animating behind them just recomposites them
+    for (auto* control : std::initializer_list<juce::Component*> { &titleLabel, &subtitleLabel, &stage1Label,
+                                                                    &stage2Label, &coreLabel, &fairingLabel,
+                                                                    &fairingButton, &fairingSyncCombo,
+                                                                    &fairingSyncLabel, &nebulaPanel })
+        control->setBufferedToImage(true);
+
     // Set initial size
     setSize(900, 600);
     setResizable(true, true);
     setResizeLimits(700, 500, 1200, 800);
 
-    // Start timer for UI updates
-    startTimerHz(30);
+    // Discard blocks and wet audio queued while no editor was open; from
+    // here on the frame scheduler drains them once per display frame, and
+    // discards any that queued up while the window was hidden or minimised,
+    // so the spectrum never shows stale audio. The decay tracking then
+    // starts over rather than fitting across the gap.
+    audioProcessor.getTelemetry().drain([](const Cosmos::TelemetryFrame&) {});
+    audioProcessor.getWetFifo().discard();
+    frameScheduler.onResume = [this]
+    {
+        audioProcessor.getTelemetry().drain([](const Cosmos::TelemetryFrame&) {});
+        audioProcessor.getWetFifo().discard();
+        decayEstimator.reset();
+        decayCurve.resetPending();
+    };
+
+    // Any mouse activity over the editor or its children counts as interaction
+    addMouseListener(this, true);
+    noteInteraction();
 }
 
 CosmosAudioProcessorEditor::~CosmosAudioProcessorEditor()
 {
-    stopTimer();
+    removeMouseListener(this);
     setLookAndFeel(nullptr);
 }
 
@@ -302,6 +332,7 @@ void CosmosAudioProcessorEditor::resized()
 
     // Header area with title on left
     auto headerArea = bounds.removeFromTop(headerHeight);
+    cpuMeter.setBounds(headerArea.removeFromRight(220).reduced(20, 12));
     auto titleSection = headerArea.reduced(20, 0);
     titleLabel.setBounds(titleSection.removeFromTop(30).withTrimmedTop(8));
     subtitleLabel.setBounds(titleSection.removeFromTop(18));
@@ -325,6 +356,9 @@ void CosmosAudioProcessorEditor::resized()
     stage2Label.setBounds(stage2Area.removeFromTop(20));
     chaosKnob.setBounds(stage2Area.removeFromLeft(knobSize + 20).reduced(5));
 
+    // Spectrum analyzer in Stage 2 area
+    spectrum.setBounds(stage2Area.reduced(5, 10));
+
     // Core controls row
     auto coreRow = bounds.removeFromTop(160).reduced(padding);
     coreLabel.setBounds(coreRow.removeFromTop(20));
@@ -370,16 +404,93 @@ void CosmosAudioProcessorEditor::resized()
     outputGainKnob.setBounds(ioArea.reduced(5));
 }
 
-void CosmosAudioProcessorEditor::timerCallback()
+void CosmosAudioProcessorEditor::mouseMove(const juce::MouseEvent&)
 {
+    noteInteraction();
+}
+
+void CosmosAudioProcessorEditor::mouseDown(const juce::MouseEvent&)
+{
+    noteInteraction();
+}
+
+void CosmosAudioProcessorEditor::mouseDrag(const juce::MouseEvent&)
+{
+    noteInteraction();
+}
+
+void CosmosAudioProcessorEditor::mouseWheelMove(const juce::MouseEvent&, const juce::MouseWheelDetails&)
+{
+    noteInteraction();
+}
+
+void CosmosAudioProcessorEditor::noteInteraction()
+{
+    lastActivityTime = juce::Time::getMillisecondCounterHiRes();
+    frameScheduler.setIdle(false);
+}
+
+void CosmosAudioProcessorEditor::updateFrame(double elapsedSeconds)
+{
+    // Drain every block processed since the last frame, holding peaks so
+    // short events between refreshes are not missed
+    float decayEnvelope = 0.0f;
+    float fairingIntensity = 0.0f;
+    bool fairingActive = false;
+    float peakLevel = 0.0f;
+
+    const int numFrames = audioProcessor.getTelemetry().drain([&](const Cosmos::TelemetryFrame& frame)
+    {
+        decayEnvelope = juce::jmax(decayEnvelope, frame.decayEnvelope);
+        fairingIntensity = juce::jmax(fairingIntensity, frame.fairingIntensity);
+        fairingActive = fairingActive || frame.fairingActive;
+        peakLevel = juce::jmax(peakLevel, frame.inputPeak[0], frame.inputPeak[1],
+                               juce::jmax(frame.outputPeak[0], frame.outputPeak[1]));
+        cpuMeter.addFrame(frame);
+        decayCurve.addFrame(frame);
+        decayEstimator.addFrame(frame);
+        latestTelemetry = frame;
+    });
+
+    cpuMeter.update();
+
+    // Animate at full rate only while audio is flowing, Fairing is running
+    // or the user is interacting; otherwise drop to the idle rate. Only
+    // blocks drained this frame count, so a held state never keeps it awake.
+    const double now = juce::Time::getMillisecondCounterHiRes();
+    if (numFrames > 0 && (peakLevel > ActivityThreshold || decayEnvelope > ActivityThreshold
+                          || fairingActive || fairingIntensity > 0.0f))
+        lastActivityTime = now;
+
+    // No blocks (transport stopped or host not processing): hold the last
+    // state on screen
+    if (numFrames == 0)
+    {
+        decayEnvelope = latestTelemetry.decayEnvelope;
+        fairingIntensity = latestTelemetry.fairingIntensity;
+        fairingActive = latestTelemetry.fairingActive;
+    }
+
+    frameScheduler.setIdle(now - lastActivityTime > IdleTimeoutMs);
+    frameScheduler.setFrameRateLimit(uiSettings->getFrameRateLimit());
+
     // Update visualizers with processor data
-    starfield.setDecayEnvelope(audioProcessor.getDecayEnvelope());
+    starfield.setDecayEnvelope(decayEnvelope);
     starfield.setModulationChaos(chaosKnob.getSlider().getValue() / 100.0f);
-    starfield.setFairingSeparationActive(audioProcessor.isFairingSeparationActive());
-    starfield.setFairingSeparationIntensity(audioProcessor.getFairingSeparationIntensity());
+    starfield.setFairingSeparationActive(fairingActive);
+    starfield.setFairingSeparationIntensity(fairingIntensity);
+    starfield.setRenderScale(uiSettings->getRenderScale());
+    starfield.advance(elapsedSeconds);
+
+    decayEstimator.setSampleRate(audioProcessor.getSampleRate());
 
-    decayCurve.setDecayEnvelope(audioProcessor.getDecayEnvelope());
+    decayCurve.setSampleRate(audioProcessor.getSampleRate());
+    decayCurve.setMeasuredDecay(decayEstimator.getMeasuredDecay());
     decayCurve.setDecayTime(static_cast<float>(decayKnob.getSlider().getValue()));
+    decayCurve.update();
+
+    spectrum.setSampleRate(audioProcessor.getSampleRate());
+    spectrum.pull(audioProcessor.getWetFifo(), elapsedSeconds);
 }
 
 void CosmosAudioProcessorEditor::applyNebulaPresetToUI(int presetIndex)
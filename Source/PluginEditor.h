@@ -5,8 +5,13 @@
 #include "UI/StarfieldVisualizer.h"
 #include "UI/EngineKnob.h"
 #include "UI/DecayCurveDisplay.h"
+#include "UI/SpectrumAnalyzer.h"
+#include "UI/CpuMeter.h"
+#include "UI/FrameScheduler.h"
+#include "UI/UiSettings.h"
 #include "UI/NebulaSelectorPanel.h"
 #include "Utils/Parameters.h"
+#include "Utils/DecayEstimator.h"
 #include "BinaryData.h"
 
 //==============================================================================
@@ -17,11 +22,12 @@
  * - Animated starfield background
  * - Engine dial knobs for all parameters
  * - Decay curve visualizer
+ * - Wet tail spectrum analyzer
+ * - Per-stage CPU meter
  * - Stage 1/2 controls with distinctive styling
  * - Fairing separation controls
  */
-class CosmosAudioProcessorEditor : public juce::AudioProcessorEditor,
-                                   public juce::Timer
+class CosmosAudioProcessorEditor : public juce::AudioProcessorEditor
 {
 public:
     CosmosAudioProcessorEditor(CosmosAudioProcessor&);
@@ -31,11 +37,26 @@ public:
     void paint(juce::Graphics&) override;
     void paintOverChildren(juce::Graphics&) override;
     void resized() override;
-    void timerCallback() override;
+
+    void mouseMove(const juce::MouseEvent&) override;
+    void mouseDown(const juce::MouseEvent&) override;
+    void mouseDrag(const juce::MouseEvent&) override;
+    void mouseWheelMove(const juce::MouseEvent&, const juce::MouseWheelDetails&) override;
 
 private:
     CosmosAudioProcessor& audioProcessor;
 
+    // Most recent block drained from the processor's telemetry ring
+    Cosmos::TelemetryFrame latestTelemetry;
+
+    // Animation drops to the idle rate once there has been no audio above
+    // ActivityThreshold and no mouse activity for IdleTimeoutMs
+    static constexpr float ActivityThreshold = 1.0e-4f;     // -80 dBFS
+    static constexpr double IdleTimeoutMs = 2000.0;
+    double lastActivityTime = 0.0;
+
+    juce::SharedResourcePointer<Cosmos::UiSettings> uiSettings;
+
     // Company logo
     juce::Image companyLogo;
 
@@ -45,8 +66,16 @@ private:
     // Background visualizer
     Cosmos::StarfieldVisualizer starfield;
 
-    // Decay curve display
+    // Decay curve display, with the decay measured from the running signal
     Cosmos::DecayCurveDisplay decayCurve;
+    Cosmos::DecayEstimator decayEstimator;
+
+    // Wet tail spectrum
+    Cosmos::SpectrumAnalyzer spectrum;
+
+    // Processing load of the plugin, by stage
+    Cosmos::CpuMeter cpuMeter;
+    juce::TooltipWindow tooltipWindow { this };
 
     // Core controls
     Cosmos::EngineKnob decayKnob { "DECAY", Cosmos::EngineKnob::Style::Standard };
@@ -94,6 +123,10 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> fairingAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> fairingSyncAttachment;
 
+    // Drives telemetry and animation once per display frame; declared last
+    // so it stops before anything it updates is destroyed
+    Cosmos::FrameScheduler frameScheduler { this, [this](double elapsedSeconds) { updateFrame(elapsedSeconds); } };
+
     //==========================================================================
     void setupKnobs();
     void setupLabels();
@@ -101,6 +134,8 @@ private:
     void setupNebulaSelector();
     void attachParameters();
     void applyNebulaPresetToUI(int presetIndex);
+    void updateFrame(double elapsedSeconds);
+    void noteInteraction();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CosmosAudioProcessorEditor)
 };
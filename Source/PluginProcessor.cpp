@@ -56,6 +56,7 @@ void CosmosAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBlock)
     // Prepare DSP components
     reverb.prepare(sampleRate, samplesPerBlock);
     fairingSeparation.prepare(sampleRate, samplesPerBlock);
+    outputMeter.prepare(sampleRate, samplesPerBlock);
 
     // Prepare dry buffer
     dryBuffer.setSize(2, samplesPerBlock);
@@ -76,6 +77,7 @@ void CosmosAudioProcessor::releaseResources()
 {
     reverb.reset();
     fairingSeparation.reset();
+    outputMeter.reset();
 }
 
 bool CosmosAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
@@ -99,6 +101,9 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     juce::ScopedNoDenormals noDenormals;
     juce::ignoreUnused(midiMessages);
 
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+    Cosmos::TelemetryFrame frame;
+
     auto totalNumInputChannels = getTotalNumInputChannels();
     auto totalNumOutputChannels = getTotalNumOutputChannels();
 
@@ -107,6 +112,7 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         buffer.clear(i, 0, buffer.getNumSamples());
 
     int numSamples = buffer.getNumSamples();
+    frame.numSamples = numSamples;
 
     // Check for nebula preset changes
     int currentNebulaPreset = static_cast<int>(nebulaPresetParam->load());
@@ -155,15 +161,7 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 
     // Update input meters
     for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
-    {
-        float maxLevel = 0.0f;
-        const float* data = buffer.getReadPointer(ch);
-        for (int i = 0; i < numSamples; ++i)
-        {
-            maxLevel = juce::jmax(maxLevel, std::abs(data[i]));
-        }
-        inputLevels[static_cast<size_t>(ch)].store(maxLevel);
-    }
+        frame.inputPeak[static_cast<size_t>(ch)] = buffer.getMagnitude(ch, 0, numSamples);
 
     // Store dry signal
     dryBuffer.makeCopyOf(buffer);
@@ -180,7 +178,12 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
     // Process reverb
     reverb.process(buffer);
 
+    // Hand the wet tail to the spectrum analyzer; the FFT runs on the message thread
+    wetFifo.push(buffer.getArrayOfReadPointers(), juce::jmin(buffer.getNumChannels(), 2), numSamples);
+
     // Handle Fairing Separation
+    const auto fairingStartTicks = juce::Time::getHighResolutionTicks();
+
     if (fairingEnabled && !prevFairingEnabled)
     {
         // Rising edge - trigger effect
@@ -203,6 +206,7 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
 
     // Process fairing separation on the input (applied to wet signal)
     fairingSeparation.process(buffer);
+    const auto fairingTicks = juce::Time::getHighResolutionTicks() - fairingStartTicks;
 
     // Mix wet/dry
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
@@ -219,28 +223,69 @@ void CosmosAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
         smoothedMix.setCurrentAndTargetValue(mix);
     }
 
-    // Apply output gain
+    // Apply output gain (vectorised once the ramp has settled)
     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
         float* data = buffer.getWritePointer(ch);
-        for (int i = 0; i < numSamples; ++i)
+        if (smoothedOutputGain.isSmoothing())
         {
-            data[i] *= smoothedOutputGain.getNextValue();
+            for (int i = 0; i < numSamples; ++i)
+                data[i] *= smoothedOutputGain.getNextValue();
+        }
+        else
+        {
+            juce::FloatVectorOperations::multiply(data, outputGain, numSamples);
         }
         smoothedOutputGain.setCurrentAndTargetValue(outputGain);
     }
 
-    // Update output meters
-    for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
+    // Meter the final output: peak, RMS, true peak and loudness
+    outputMeter.process(buffer.getArrayOfReadPointers(), juce::jmin(buffer.getNumChannels(), 2), numSamples);
+
+    const auto& levels = outputMeter.getLevels();
+    frame.outputPeak = levels.peak;
+    frame.outputRms = levels.rms;
+    frame.outputTruePeak = levels.truePeak;
+    frame.momentaryLufs = levels.momentaryLufs;
+    frame.shortTermLufs = levels.shortTermLufs;
+
+    // Publish this block to the editor (dropped if the UI is behind)
+    frame.tankEnergy = reverb.getTankEnergy();
+    frame.tankMin = reverb.getTankRange().getStart();
+    frame.tankMax = reverb.getTankRange().getEnd();
+    frame.decayEnvelope = reverb.getDecayEnvelope();
+    frame.fairingPhase = fairingSeparation.getPhase();
+    frame.fairingIntensity = fairingSeparation.getIntensity();
+    frame.fairingActive = fairingSeparation.getIsActive();
+
+    // CPU load as a share of the block's real-time budget; I/O is everything
+    // outside the timed stages (gain, mix, metering, buffer copies)
+    const double blockSeconds = numSamples / getSampleRate();
+    auto toLoad = [blockSeconds](juce::int64 ticks)
     {
-        float maxLevel = 0.0f;
-        const float* data = buffer.getReadPointer(ch);
-        for (int i = 0; i < numSamples; ++i)
-        {
-            maxLevel = juce::jmax(maxLevel, std::abs(data[i]));
-        }
-        outputLevels[static_cast<size_t>(ch)].store(maxLevel);
-    }
+        return blockSeconds > 0.0 ? static_cast<float>(juce::Time::highResolutionTicksToSeconds(ticks) / blockSeconds)
+                                  : 0.0f;
+    };
+
+    const auto totalTicks = juce::Time::getHighResolutionTicks() - startTicks;
+    const auto& reverbTicks = reverb.getStageTicks();
+    const auto timedTicks = reverbTicks.preDelay + reverbTicks.diffusion + reverbTicks.tank
+                          + reverbTicks.filters + fairingTicks;
+
+    auto stageLoad = [&frame](Cosmos::TelemetryStage stage) -> float&
+    {
+        return frame.stageLoad[static_cast<size_t>(stage)];
+    };
+
+    stageLoad(Cosmos::TelemetryStage::PreDelay) = toLoad(reverbTicks.preDelay);
+    stageLoad(Cosmos::TelemetryStage::Diffusion) = toLoad(reverbTicks.diffusion);
+    stageLoad(Cosmos::TelemetryStage::Tank) = toLoad(reverbTicks.tank);
+    stageLoad(Cosmos::TelemetryStage::Filters) = toLoad(reverbTicks.filters);
+    stageLoad(Cosmos::TelemetryStage::Fairing) = toLoad(fairingTicks);
+    stageLoad(Cosmos::TelemetryStage::IO) = toLoad(juce::jmax(juce::int64 { 0 }, totalTicks - timedTicks));
+    frame.cpuLoad = toLoad(totalTicks);
+
+    telemetry.push(frame);
 }
 
 //==============================================================================
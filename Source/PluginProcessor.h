@@ -5,7 +5,10 @@
 
 #include "DSP/AlgorithmicReverb.h"
 #include "DSP/FairingSeparation.h"
+#include "DSP/LoudnessMeter.h"
 #include "Utils/Parameters.h"
+#include "Utils/Telemetry.h"
+#include "Utils/AudioFifo.h"
 
 //==============================================================================
 /**
@@ -54,14 +57,11 @@ public:
     // Parameter access
     juce::AudioProcessorValueTreeState& getParameters() { return parameters; }
 
-    // Visualization data
-    float getDecayEnvelope() const { return reverb.getDecayEnvelope(); }
-    float getFairingSeparationIntensity() const { return fairingSeparation.getIntensity(); }
-    bool isFairingSeparationActive() const { return fairingSeparation.getIsActive(); }
+    // Per-block visualization and metering data, drained by the editor
+    Cosmos::TelemetryRing& getTelemetry() { return telemetry; }
 
-    // Input/Output levels for metering
-    float getInputLevel(int channel) const { return inputLevels[channel].load(); }
-    float getOutputLevel(int channel) const { return outputLevels[channel].load(); }
+    // Wet reverb signal (mono) for the editor's spectrum analyzer
+    Cosmos::AudioFifo& getWetFifo() { return wetFifo; }
 
 private:
     //==============================================================================
@@ -89,9 +89,12 @@ private:
     // Dry buffer for wet/dry mixing
     juce::AudioBuffer<float> dryBuffer;
 
-    // Metering
-    std::array<std::atomic<float>, 2> inputLevels = { 0.0f, 0.0f };
-    std::array<std::atomic<float>, 2> outputLevels = { 0.0f, 0.0f };
+    // Output peak, RMS, true peak and loudness
+    Cosmos::LoudnessMeter outputMeter;
+
+    // Metering and visualization frames for the editor
+    Cosmos::TelemetryRing telemetry;
+    Cosmos::AudioFifo wetFifo { 32768 };
 
     // Previous fairing state for edge detection
     bool prevFairingEnabled = false;
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Bounded single-producer / single-consumer queue of block indices
+ *
+ * The render pipeline passes indices into a fixed pool of preallocated
+ * blocks between its stages. push() and tryPop() are lock-free (AbstractFifo);
+ * pop() waits on an event only when the queue is empty, so a stage that is
+ * ahead parks instead of spinning.
+ *
+ * Capacity must be larger than the number of blocks in circulation, so a
+ * push can never find the queue full.
+ */
+template <int Capacity>
+class BlockQueue
+{
+public:
+    BlockQueue() = default;
+
+    void push(int blockIndex)
+    {
+        {
+            const auto scope = fifo.write(1);
+            jassert(scope.blockSize1 == 1); // More blocks in flight than the queue can hold
+
+            if (scope.blockSize1 > 0)
+                slots[static_cast<size_t>(scope.startIndex1)] = blockIndex;
+        }
+
+        dataAvailable.signal();
+    }
+
+    bool tryPop(int& blockIndex)
+    {
+        const auto scope = fifo.read(1);
+
+        if (scope.blockSize1 == 0)
+            return false;
+
+        blockIndex = slots[static_cast<size_t>(scope.startIndex1)];
+        return true;
+    }
+
+    int pop()
+    {
+        int blockIndex = -1;
+
+        // The timeout covers a signal that lands between tryPop() and wait()
+        while (!tryPop(blockIndex))
+            dataAvailable.wait(1);
+
+        return blockIndex;
+    }
+
+private:
+    juce::AbstractFifo fifo { Capacity };
+    std::array<int, Capacity> slots {};
+    juce::WaitableEvent dataAvailable;
+
+    JUCE_DECLARE_NON_COPYABLE(BlockQueue)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,202 @@
+/*
+  ==============================================================================
+    Cosmos - Cinematic Space Reverb
+    CosmosAnalyze - Decay analysis of rendered impulse responses
+
+    Renders the impulse response of each nebula preset and measures how its
+    decay compares with the Deep Space Decay setting: Schroeder energy decay
+    curves per octave band (125 Hz - 8 kHz) and broadband, with EDT, T20 and
+    T30 for each.
+
+    Usage:
+      CosmosAnalyze [options]
+
+    Options:
+      --preset=<n|name>     Analyse one preset (default: all)
+      --decay=<seconds>     Override the decay of the analysed presets
+      --rate=<hz>           Sample rate (default: 48000)
+      --seed=<n>            Modulation seed (default: 1)
+      --jobs=<n>            Worker threads (default: number of CPU cores)
+      --csv=<file>          Also write the results as CSV
+  ==============================================================================
+*/
+
+#include "DecayAnalysis.h"
+#include "ImpulseResponse.h"
+#include "ToolArguments.h"
+#include "WorkStealingPool.h"
+#include <iostream>
+
+namespace
+{
+
+//==============================================================================
+struct PresetAnalysis
+{
+    int presetIndex = 0;
+    Cosmos::CosmosEngine::Settings settings;
+    Cosmos::DecayAnalysis::BandDecay broadband;
+    std::vector<Cosmos::DecayAnalysis::BandDecay> bands;
+};
+
+juce::String formatSeconds(double seconds)
+{
+    return seconds > 0.0 ? juce::String(seconds, 2) : juce::String("-");
+}
+
+// Measured T30 relative to the decay setting
+juce::String formatRatio(double t30, float decay)
+{
+    return t30 > 0.0 ? juce::String(t30 / decay, 2) : juce::String("-");
+}
+
+juce::String formatBand(double centreHz)
+{
+    return centreHz >= 1000.0 ? juce::String(centreHz / 1000.0, 0) + " kHz"
+                              : juce::String(centreHz, 0) + " Hz";
+}
+
+void printAnalysis(const PresetAnalysis& analysis)
+{
+    const auto& s = analysis.settings;
+
+    std::cout << Cosmos::NebulaPresets::getPreset(analysis.presetIndex).name
+              << "  (decay " << juce::String(s.decay, 1) << " s, high cut " << juce::String(s.highCut, 0)
+              << " Hz, low cut " << juce::String(s.lowCut, 0) << " Hz)" << std::endl;
+
+    std::cout << "  " << juce::String("Band").paddedRight(' ', 10)
+              << juce::String("EDT").paddedLeft(' ', 8) << juce::String("T20").paddedLeft(' ', 8)
+              << juce::String("T30").paddedLeft(' ', 8) << juce::String("T30/decay").paddedLeft(' ', 11)
+              << std::endl;
+
+    auto printRow = [&s](const juce::String& label, const Cosmos::DecayAnalysis::BandDecay& band)
+    {
+        std::cout << "  " << label.paddedRight(' ', 10)
+                  << formatSeconds(band.edt).paddedLeft(' ', 8) << formatSeconds(band.t20).paddedLeft(' ', 8)
+                  << formatSeconds(band.t30).paddedLeft(' ', 8) << formatRatio(band.t30, s.decay).paddedLeft(' ', 11)
+                  << std::endl;
+    };
+
+    for (const auto& band : analysis.bands)
+        printRow(formatBand(band.centreHz), band);
+
+    printRow("Broadband", analysis.broadband);
+    std::cout << std::endl;
+}
+
+void writeCsv(const std::vector<PresetAnalysis>& analyses, const juce::File& file)
+{
+    juce::String csv = "preset,name,decay,band,edt,t20,t30,t30_ratio\n";
+
+    auto addRow = [&csv](const PresetAnalysis& analysis, const juce::String& band,
+                         const Cosmos::DecayAnalysis::BandDecay& decay)
+    {
+        csv << analysis.presetIndex << ",\"" << Cosmos::NebulaPresets::getPreset(analysis.presetIndex).name << "\","
+            << analysis.settings.decay << "," << band << ","
+            << decay.edt << "," << decay.t20 << "," << decay.t30 << ","
+            << (decay.t30 > 0.0 ? decay.t30 / analysis.settings.decay : -1.0) << "\n";
+    };
+
+    for (const auto& analysis : analyses)
+    {
+        for (const auto& band : analysis.bands)
+            addRow(analysis, juce::String(band.centreHz, 0), band);
+
+        addRow(analysis, "broadband", analysis.broadband);
+    }
+
+    if (!file.replaceWithText(csv))
+        juce::ConsoleApplication::fail("Cannot write " + file.getFullPathName());
+}
+
+//==============================================================================
+void runAnalysis(const juce::ArgumentList& args)
+{
+    std::vector<PresetAnalysis> analyses;
+
+    if (args.containsOption("--preset"))
+    {
+        analyses.push_back({});
+        analyses.back().presetIndex = Cosmos::ToolArguments::parsePreset(args.getValueForOption("--preset"));
+    }
+    else
+    {
+        for (int i = 0; i < Cosmos::NebulaPresets::getNumPresets(); ++i)
+        {
+            analyses.push_back({});
+            analyses.back().presetIndex = i;
+        }
+    }
+
+    for (auto& analysis : analyses)
+    {
+        analysis.settings = Cosmos::CosmosEngine::Settings::fromPreset(analysis.presetIndex);
+
+        if (args.containsOption("--decay"))
+            analysis.settings.decay = args.getValueForOption("--decay").getFloatValue();
+    }
+
+    const double sampleRate = args.containsOption("--rate")
+                            ? args.getValueForOption("--rate").getDoubleValue()
+                            : 48000.0;
+
+    if (sampleRate < 8000.0 || sampleRate > 384000.0)
+        juce::ConsoleApplication::fail("Invalid sample rate");
+
+    const auto seed = args.containsOption("--seed")
+                    ? static_cast<juce::uint32>(args.getValueForOption("--seed").getLargeIntValue())
+                    : juce::uint32 { 1 };
+
+    int numJobs = juce::SystemStats::getNumCpus();
+    if (args.containsOption("--jobs"))
+        numJobs = args.getValueForOption("--jobs").getIntValue();
+
+    Cosmos::WorkStealingPool pool(juce::jlimit(1, static_cast<int>(analyses.size()), numJobs));
+
+    std::vector<std::unique_ptr<Cosmos::ImpulseRenderer>> renderers;
+    std::vector<juce::AudioBuffer<float>> buffers(static_cast<size_t>(pool.getNumWorkers()));
+    for (int i = 0; i < pool.getNumWorkers(); ++i)
+        renderers.push_back(std::make_unique<Cosmos::ImpulseRenderer>());
+
+    pool.parallelFor(static_cast<int>(analyses.size()), [&](int taskIndex, int workerIndex)
+    {
+        auto& analysis = analyses[static_cast<size_t>(taskIndex)];
+        auto& ir = buffers[static_cast<size_t>(workerIndex)];
+
+        renderers[static_cast<size_t>(workerIndex)]->render(
+            analysis.settings, sampleRate, seed,
+            Cosmos::ImpulseRenderer::getDefaultLengthSeconds(analysis.settings), ir);
+
+        const auto edc = Cosmos::DecayAnalysis::energyDecayCurve(ir);
+        analysis.broadband.edt = Cosmos::DecayAnalysis::edt(edc, sampleRate);
+        analysis.broadband.t20 = Cosmos::DecayAnalysis::t20(edc, sampleRate);
+        analysis.broadband.t30 = Cosmos::DecayAnalysis::t30(edc, sampleRate);
+        analysis.bands = Cosmos::DecayAnalysis::analyseOctaveBands(ir, sampleRate);
+    });
+
+    for (const auto& analysis : analyses)
+        printAnalysis(analysis);
+
+    if (args.containsOption("--csv"))
+        writeCsv(analyses, args.getFileForOption("--csv"));
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ConsoleApplication app;
+
+    app.addHelpCommand("--help|-h", "Usage: CosmosAnalyze [options]", false);
+    app.addVersionCommand("--version|-v", juce::String("CosmosAnalyze ") + JUCE_APPLICATION_VERSION_STRING);
+
+    app.addDefaultCommand({ "",
+                            "[options]",
+                            "Measure the decay of the nebula presets",
+                            "Renders preset impulse responses and reports EDT, T20 and T30 per octave band "
+                            "against the decay setting.",
+                            runAnalysis });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,768 @@
+/*
+  ==============================================================================
+    Cosmos - Cinematic Space Reverb
+    CosmosRender - Offline batch renderer
+
+    Renders a list of files or directories through one Cosmos setting,
+    processing files concurrently with one engine per worker thread, or
+    splitting single long files into segments rendered across workers.
+
+    Usage:
+      CosmosRender [options] <file|directory>...
+
+    Options:
+      --out=<dir>           Output directory (default: next to each input);
+                            files found in a directory keep their path
+                            relative to it
+      --list=<file>         Text file with one input path per line
+      --jobs=<n>            Worker threads (default: number of CPU cores)
+      --preset=<n|name>     Nebula preset to start from (default: Manual)
+      --decay= --predelay= --highcut= --lowcut= --mix= --width=
+      --thrust= --chaos= --input-gain= --output-gain=
+                            Override individual settings (plugin units)
+      --tail=<seconds>      Tail rendered after the input (default: pre-delay + decay)
+      --bits=<16|24|32>     Output bit depth (default: 24)
+      --block=<samples>     Processing block size (default: 4096)
+      --seed=<n>            Deterministic modulation with the given seed
+      --split[=<n>]         Render each file as n segments on all workers
+                            (default n: number of workers)
+      --crossfade=<ms>      Segment stitching crossfade (default: 10 ms)
+      --cache=<dir>         Reuse renders of identical input and settings
+      --cache-size=<MB>     Cache size budget, least recently used renders
+                            are evicted first (default: 4096 MB)
+
+    Impulse response catalog:
+      CosmosRender --ir-catalog [options] [preset|directory]...
+
+      Renders true-stereo impulse responses (4-channel float WAV: LL, LR,
+      RL, RR) of every nebula preset, plus any user presets, at each sample
+      rate, and writes index.json with the measured RT60 and energy of each
+      response. User presets are the plugin's saved state: a host preset
+      (.vstpreset, .aupreset), the raw state blob, or its XML.
+
+      --out=<dir>           Output directory (default: ./CosmosIRs)
+      --rates=<hz,...>      Sample rates (default: 44100,48000,96000)
+      --length=<seconds>    Response length (default: pre-delay + 1.5x decay)
+      --seed=<n>            Modulation seed (default: 1)
+      --jobs=<n>            Worker threads (default: number of CPU cores)
+  ==============================================================================
+*/
+
+#include "DecayAnalysis.h"
+#include "FileRenderer.h"
+#include "ImpulseResponse.h"
+#include "RenderCache.h"
+#include "SegmentedRenderer.h"
+#include "ToolArguments.h"
+#include "WorkStealingPool.h"
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+//==============================================================================
+void applyOverride(const juce::ArgumentList& args, const juce::String& option, float& value)
+{
+    if (args.containsOption(option))
+        value = args.getValueForOption(option).getFloatValue();
+}
+
+Cosmos::RenderOptions parseOptions(const juce::ArgumentList& args)
+{
+    Cosmos::RenderOptions options;
+
+    if (args.containsOption("--preset"))
+    {
+        const auto preset = Cosmos::ToolArguments::parsePreset(args.getValueForOption("--preset"));
+        options.settings = Cosmos::CosmosEngine::Settings::fromPreset(preset);
+    }
+
+    auto& s = options.settings;
+    applyOverride(args, "--decay", s.decay);
+    applyOverride(args, "--predelay", s.preDelay);
+    applyOverride(args, "--highcut", s.highCut);
+    applyOverride(args, "--lowcut", s.lowCut);
+    applyOverride(args, "--mix", s.mix);
+    applyOverride(args, "--width", s.width);
+    applyOverride(args, "--thrust", s.diffusionThrust);
+    applyOverride(args, "--chaos", s.modulationChaos);
+    applyOverride(args, "--input-gain", s.inputGain);
+    applyOverride(args, "--output-gain", s.outputGain);
+
+    if (args.containsOption("--tail"))
+        options.tailSeconds = juce::jmax(0.0, args.getValueForOption("--tail").getDoubleValue());
+
+    if (args.containsOption("--bits"))
+    {
+        options.bitsPerSample = args.getValueForOption("--bits").getIntValue();
+        if (options.bitsPerSample != 16 && options.bitsPerSample != 24 && options.bitsPerSample != 32)
+            juce::ConsoleApplication::fail("--bits must be 16, 24 or 32");
+    }
+
+    if (args.containsOption("--block"))
+        options.blockSize = juce::jlimit(64, 65536, args.getValueForOption("--block").getIntValue());
+
+    if (args.containsOption("--seed"))
+    {
+        options.deterministic = true;
+        options.seed = static_cast<juce::uint32>(args.getValueForOption("--seed").getLargeIntValue());
+    }
+
+    return options;
+}
+
+//==============================================================================
+// An input file and the directory its output path is mirrored from: the
+// directory argument it was found under, or its own parent
+struct InputFile
+{
+    juce::File file;
+    juce::File root;
+};
+
+void addInput(const juce::File& file, std::vector<InputFile>& inputs)
+{
+    if (file.isDirectory())
+    {
+        auto found = file.findChildFiles(juce::File::findFiles, true, "*.wav;*.aif;*.aiff;*.flac");
+        found.sort();
+
+        // Earlier renders, e.g. when --out is inside the input directory
+        for (const auto& child : found)
+            if (!child.getFileNameWithoutExtension().endsWith("_cosmos"))
+                inputs.push_back({ child, file });
+    }
+    else if (file.existsAsFile())
+    {
+        inputs.push_back({ file, file.getParentDirectory() });
+    }
+    else
+    {
+        juce::ConsoleApplication::fail("Input not found: " + file.getFullPathName());
+    }
+}
+
+std::vector<InputFile> collectInputs(const juce::ArgumentList& args)
+{
+    std::vector<InputFile> inputs;
+
+    if (args.containsOption("--list"))
+    {
+        auto listFile = args.getExistingFileForOption("--list");
+        juce::StringArray lines;
+        listFile.readLines(lines);
+
+        for (auto& line : lines)
+            if (line.trim().isNotEmpty())
+                addInput(listFile.getParentDirectory().getChildFile(line.trim()), inputs);
+    }
+
+    for (const auto& arg : args.arguments)
+        if (!arg.isOption())
+            addInput(arg.resolveAsFile(), inputs);
+
+    if (inputs.empty())
+        juce::ConsoleApplication::fail("No input files");
+
+    return inputs;
+}
+
+// Share of the busy time spent decoding and encoding rather than in the engine
+double getIoShare(const Cosmos::RenderResult& result)
+{
+    const double io = result.decodeSeconds + result.encodeSeconds;
+    return io / juce::jmax(io + result.dspSeconds, 1.0e-9);
+}
+
+juce::String formatPercent(double fraction)
+{
+    return juce::String(fraction * 100.0, 1) + "%";
+}
+
+// Next to the input, or under outputDir at the input's path relative to its root
+juce::File getOutputFile(const InputFile& input, const juce::File& outputDir)
+{
+    auto dir = input.file.getParentDirectory();
+    if (outputDir != juce::File())
+        dir = outputDir.getChildFile(dir.getRelativePathFrom(input.root));
+
+    return dir.getChildFile(input.file.getFileNameWithoutExtension() + "_cosmos.wav");
+}
+
+// Output file of every input. Fails before anything is rendered if two
+// inputs would write the same file or an output directory cannot be made.
+juce::Array<juce::File> getOutputFiles(const std::vector<InputFile>& inputs, const juce::File& outputDir)
+{
+    juce::Array<juce::File> outputs;
+    juce::StringArray paths;
+
+    for (const auto& input : inputs)
+    {
+        const auto output = getOutputFile(input, outputDir);
+
+        if (paths.contains(output.getFullPathName(), !juce::File::areFileNamesCaseSensitive()))
+            juce::ConsoleApplication::fail("More than one input would be rendered to " + output.getFullPathName());
+
+        if (!output.getParentDirectory().createDirectory())
+            juce::ConsoleApplication::fail("Cannot create output directory: "
+                                           + output.getParentDirectory().getFullPathName());
+
+        paths.add(output.getFullPathName());
+        outputs.add(output);
+    }
+
+    return outputs;
+}
+
+//==============================================================================
+void runBatch(const juce::ArgumentList& args)
+{
+    const auto options = parseOptions(args);
+    const auto inputs = collectInputs(args);
+
+    juce::File outputDir;
+    if (args.containsOption("--out"))
+    {
+        outputDir = args.getFileForOption("--out");
+        if (!outputDir.createDirectory())
+            juce::ConsoleApplication::fail("Cannot create output directory: " + outputDir.getFullPathName());
+    }
+
+    const auto outputs = getOutputFiles(inputs, outputDir);
+
+    const bool split = args.containsOption("--split");
+
+    std::unique_ptr<Cosmos::RenderCache> cache;
+    if (args.containsOption("--cache"))
+    {
+        const auto budgetMB = args.containsOption("--cache-size")
+                            ? args.getValueForOption("--cache-size").getLargeIntValue()
+                            : static_cast<juce::int64>(4096);
+
+        cache = std::make_unique<Cosmos::RenderCache>(args.getFileForOption("--cache"),
+                                                      juce::jmax(static_cast<juce::int64>(0), budgetMB) * 1024 * 1024);
+        if (!cache->initialise())
+            juce::ConsoleApplication::fail("Cannot create cache directory: " + cache->getDirectory().getFullPathName());
+    }
+
+    int numJobs = juce::SystemStats::getNumCpus();
+    if (args.containsOption("--jobs"))
+        numJobs = args.getValueForOption("--jobs").getIntValue();
+    numJobs = juce::jmax(1, split ? numJobs : juce::jmin(static_cast<int>(inputs.size()), numJobs));
+
+    Cosmos::WorkStealingPool pool(numJobs);
+
+    // One renderer (engine + buffers) per worker, reused for every file it picks up
+    std::vector<std::unique_ptr<Cosmos::FileRenderer>> renderers;
+    for (int i = 0; i < pool.getNumWorkers(); ++i)
+        renderers.push_back(std::make_unique<Cosmos::FileRenderer>(options));
+
+    std::vector<Cosmos::RenderResult> results(inputs.size());
+    juce::CriticalSection outputLock;
+
+    std::cout << "Rendering " << inputs.size() << " file(s) on " << pool.getNumWorkers()
+              << " worker(s)" << (split ? ", split into segments" : "") << std::endl;
+
+    auto report = [&](const juce::File& input, Cosmos::RenderResult result, int index)
+    {
+        const juce::ScopedLock sl(outputLock);
+
+        if (result.ok && result.cached)
+            std::cout << "  " << input.getFileName() << "  cached" << std::endl;
+        else if (result.ok)
+            std::cout << "  " << input.getFileName() << "  "
+                      << juce::String(result.audioSeconds / juce::jmax(result.wallSeconds, 1.0e-9), 1) << "x realtime, I/O "
+                      << formatPercent(getIoShare(result)) << " of stage time" << std::endl;
+        else
+            std::cerr << "  FAILED: " << result.error << std::endl;
+
+        results[static_cast<size_t>(index)] = std::move(result);
+    };
+
+    int numSegments = args.getValueForOption("--split").getIntValue();
+    if (numSegments <= 0)
+        numSegments = pool.getNumWorkers();
+
+    const double crossfadeMs = args.containsOption("--crossfade")
+                             ? args.getValueForOption("--crossfade").getDoubleValue()
+                             : 10.0;
+
+    // Segmented output differs slightly from a serial render, so it is cached separately
+    const auto cacheVariant = split ? "split " + juce::String(numSegments) + " crossfade " + juce::String(crossfadeMs)
+                                    : juce::String();
+
+    // Serves a render from the cache when possible, otherwise renders and stores it
+    auto renderWithCache = [&](const juce::File& input, const juce::File& output,
+                               const std::function<Cosmos::RenderResult()>& renderFile)
+    {
+        if (cache == nullptr)
+            return renderFile();
+
+        const auto key = Cosmos::RenderCache::computeKey(input, options, cacheVariant);
+        auto result = cache->fetch(key, output);
+
+        if (result.ok)
+        {
+            result.cached = true;
+            return result;
+        }
+
+        result = renderFile();
+
+        if (result.ok && !cache->store(key, output))
+            std::cerr << "  cannot cache " << output.getFileName() << std::endl;
+
+        return result;
+    };
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    if (split)
+    {
+        // One file at a time, each spread over every worker
+        Cosmos::SegmentedRenderer segmented(options, pool, renderers);
+        segmented.setNumSegments(numSegments);
+        segmented.setCrossfadeMs(crossfadeMs);
+
+        for (int i = 0; i < static_cast<int>(inputs.size()); ++i)
+        {
+            const auto input = inputs[static_cast<size_t>(i)].file;
+            const auto output = outputs[i];
+            report(input, renderWithCache(input, output, [&] { return segmented.render(input, output); }), i);
+        }
+    }
+    else
+    {
+        pool.parallelFor(static_cast<int>(inputs.size()), [&](int taskIndex, int workerIndex)
+        {
+            const auto input = inputs[static_cast<size_t>(taskIndex)].file;
+            const auto output = outputs[taskIndex];
+            auto& renderer = *renderers[static_cast<size_t>(workerIndex)];
+
+            report(input, renderWithCache(input, output, [&] { return renderer.render(input, output); }), taskIndex);
+        });
+    }
+
+    const double wallSeconds = juce::Time::highResolutionTicksToSeconds(
+        juce::Time::getHighResolutionTicks() - startTicks);
+
+    Cosmos::RenderResult total;
+    int numFailed = 0;
+    int numCached = 0;
+
+    for (const auto& result : results)
+    {
+        if (result.cached)
+            ++numCached;
+
+        total.audioSeconds += result.audioSeconds;
+        total.decodeSeconds += result.decodeSeconds;
+        total.dspSeconds += result.dspSeconds;
+        total.encodeSeconds += result.encodeSeconds;
+
+        if (!result.ok)
+            ++numFailed;
+    }
+
+    std::cout << "Rendered " << juce::String(total.audioSeconds, 1) << " s of audio in "
+              << juce::String(wallSeconds, 2) << " s ("
+              << juce::String(total.audioSeconds / juce::jmax(wallSeconds, 1.0e-9), 1) << "x realtime)" << std::endl;
+
+    std::cout << "Stage time: decode " << juce::String(total.decodeSeconds, 2)
+              << " s, dsp " << juce::String(total.dspSeconds, 2)
+              << " s, encode " << juce::String(total.encodeSeconds, 2)
+              << " s (I/O " << formatPercent(getIoShare(total)) << ")" << std::endl;
+
+    if (cache != nullptr)
+        std::cout << "Cache: " << numCached << " of " << inputs.size() << " file(s) served from "
+                  << cache->getDirectory().getFullPathName() << std::endl;
+
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail(juce::String(numFailed) + " file(s) failed");
+}
+
+//==============================================================================
+struct CatalogPreset
+{
+    juce::String name;
+    int presetIndex = -1;           // < 0 = user preset
+    Cosmos::CosmosEngine::Settings settings;
+};
+
+struct CatalogEntry
+{
+    int preset = 0;
+    double sampleRate = 0.0;
+    juce::File file;
+    bool ok = false;
+    double rt60 = -1.0;             // T30, or T20 when the response is too short for T30
+    double edt = -1.0;
+    std::array<double, Cosmos::ImpulseRenderer::NumChannels> energyDb {};
+};
+
+// Payload of the "Comp" (component state) chunk of a VST3 .vstpreset
+juce::MemoryBlock readVst3ComponentState(const juce::MemoryBlock& file)
+{
+    juce::MemoryInputStream in(file, false);
+
+    // Header: "VST3", version, 32-character class ID, chunk list offset
+    if (in.readInt() != static_cast<int>(juce::ByteOrder::littleEndianInt("VST3")))
+        return {};
+
+    in.skipNextBytes(4 + 32);
+    if (!in.setPosition(in.readInt64()) || in.readInt() != static_cast<int>(juce::ByteOrder::littleEndianInt("List")))
+        return {};
+
+    const int numEntries = in.readInt();
+
+    for (int i = 0; i < numEntries && !in.isExhausted(); ++i)
+    {
+        const int id = in.readInt();
+        const auto offset = in.readInt64();
+        const auto size = in.readInt64();
+
+        if (id == static_cast<int>(juce::ByteOrder::littleEndianInt("Comp"))
+            && offset >= 0 && size > 0 && offset + size <= static_cast<juce::int64>(file.getSize()))
+            return { static_cast<const char*>(file.getData()) + offset, static_cast<size_t>(size) };
+    }
+
+    return {};
+}
+
+// Base64 payload of the jucePluginState key of an AU .aupreset property list
+juce::MemoryBlock readAuPluginState(const juce::XmlElement& plist)
+{
+    if (auto* dict = plist.getChildByName("dict"))
+    {
+        for (auto* key : dict->getChildWithTagNameIterator("key"))
+        {
+            if (key->getAllSubText().trim() != "jucePluginState")
+                continue;
+
+            auto* data = key->getNextElement();
+            juce::MemoryOutputStream decoded;
+
+            if (data != nullptr && data->hasTagName("data")
+                && juce::Base64::convertFromBase64(decoded, data->getAllSubText().removeCharacters(" \t\r\n")))
+                return decoded.getMemoryBlock();
+        }
+    }
+
+    return {};
+}
+
+// The plugin state in a preset file: what getStateInformation() writes
+// (JUCE's binary XML wrapper) stored raw, inside a host's .vstpreset or
+// .aupreset, or as plain XML
+std::unique_ptr<juce::XmlElement> readPluginState(const juce::File& file)
+{
+    juce::MemoryBlock data;
+    if (!file.loadFileAsData(data) || data.isEmpty())
+        return nullptr;
+
+    juce::MemoryBlock state;
+
+    if (file.hasFileExtension("vstpreset"))
+    {
+        state = readVst3ComponentState(data);
+    }
+    else if (file.hasFileExtension("aupreset"))
+    {
+        if (auto plist = juce::parseXML(data.toString()))
+            state = readAuPluginState(*plist);
+    }
+    else if (auto xml = juce::parseXML(data.toString()))
+    {
+        return xml;
+    }
+    else
+    {
+        state = data;
+    }
+
+    return juce::AudioProcessor::getXmlFromBinary(state.getData(), static_cast<int>(state.getSize()));
+}
+
+// Reads a user preset: the plugin's saved state (<CosmosParams>, one
+// <PARAM id= value=/> per parameter) from any file readPluginState accepts
+bool loadUserPreset(const juce::File& file, CatalogPreset& preset)
+{
+    auto xml = readPluginState(file);
+    if (xml == nullptr || !xml->hasTagName("CosmosParams"))
+        return false;
+
+    const auto state = juce::ValueTree::fromXml(*xml);
+
+    auto read = [&state](const juce::String& id, float& value)
+    {
+        const auto param = state.getChildWithProperty("id", id);
+        if (param.isValid() && param.hasProperty("value"))
+            value = static_cast<float>(param["value"]);
+    };
+
+    auto& s = preset.settings;
+    read(Cosmos::ParamIDs::decay, s.decay);
+    read(Cosmos::ParamIDs::preDelay, s.preDelay);
+    read(Cosmos::ParamIDs::highCut, s.highCut);
+    read(Cosmos::ParamIDs::lowCut, s.lowCut);
+    read(Cosmos::ParamIDs::width, s.width);
+    read(Cosmos::ParamIDs::diffusionThrust, s.diffusionThrust);
+    read(Cosmos::ParamIDs::modulationChaos, s.modulationChaos);
+
+    preset.name = file.getFileNameWithoutExtension();
+    preset.presetIndex = -1;
+    return true;
+}
+
+std::vector<CatalogPreset> collectCatalogPresets(const juce::ArgumentList& args)
+{
+    std::vector<CatalogPreset> presets;
+
+    for (int i = 0; i < Cosmos::NebulaPresets::getNumPresets(); ++i)
+        presets.push_back({ Cosmos::NebulaPresets::getPreset(i).name, i, Cosmos::CosmosEngine::Settings::fromPreset(i) });
+
+    for (const auto& arg : args.arguments)
+    {
+        if (arg.isOption())
+            continue;
+
+        const auto path = arg.resolveAsFile();
+        auto files = path.isDirectory() ? path.findChildFiles(juce::File::findFiles, false,
+                                                                    "*.xml;*.vstpreset;*.aupreset;*.bin")
+                                        : juce::Array<juce::File> { path };
+        files.sort();
+
+        for (const auto& file : files)
+        {
+            CatalogPreset preset;
+            if (!loadUserPreset(file, preset))
+                juce::ConsoleApplication::fail("Not a Cosmos preset: " + file.getFullPathName());
+
+            presets.push_back(preset);
+        }
+    }
+
+    return presets;
+}
+
+juce::Array<double> parseRates(const juce::ArgumentList& args)
+{
+    if (!args.containsOption("--rates"))
+        return { 44100.0, 48000.0, 96000.0 };
+
+    juce::Array<double> rates;
+
+    for (const auto& token : juce::StringArray::fromTokens(args.getValueForOption("--rates"), ",", ""))
+    {
+        const double rate = token.trim().getDoubleValue();
+        if (rate < 8000.0 || rate > 384000.0)
+            juce::ConsoleApplication::fail("Invalid sample rate: " + token);
+
+        rates.addIfNotAlreadyThere(rate);
+    }
+
+    return rates;
+}
+
+juce::File getImpulseFile(const CatalogPreset& preset, double sampleRate, const juce::File& outputDir)
+{
+    const auto prefix = preset.presetIndex >= 0 ? juce::String(preset.presetIndex).paddedLeft('0', 2)
+                                                : juce::String("user");
+
+    return outputDir.getChildFile(juce::File::createLegalFileName(
+        prefix + "_" + preset.name + "_" + juce::String(juce::roundToInt(sampleRate)) + ".wav"));
+}
+
+bool writeImpulse(const juce::AudioBuffer<float>& ir, double sampleRate, const juce::File& file)
+{
+    file.deleteFile();
+
+    std::unique_ptr<juce::OutputStream> stream(file.createOutputStream());
+    if (stream == nullptr)
+        return false;
+
+    juce::WavAudioFormat wavFormat;
+    std::unique_ptr<juce::AudioFormatWriter> writer(wavFormat.createWriterFor(
+        stream.get(), sampleRate, static_cast<unsigned int>(ir.getNumChannels()), 32, {}, 0));
+
+    if (writer == nullptr)
+        return false;
+
+    stream.release(); // Owned by the writer now
+    return writer->writeFromAudioSampleBuffer(ir, 0, ir.getNumSamples());
+}
+
+juce::var settingsToVar(const Cosmos::CosmosEngine::Settings& s)
+{
+    auto* object = new juce::DynamicObject();
+    object->setProperty("decay", s.decay);
+    object->setProperty("preDelay", s.preDelay);
+    object->setProperty("highCut", s.highCut);
+    object->setProperty("lowCut", s.lowCut);
+    object->setProperty("width", s.width);
+    object->setProperty("diffusionThrust", s.diffusionThrust);
+    object->setProperty("modulationChaos", s.modulationChaos);
+    return juce::var(object);
+}
+
+void writeCatalogIndex(const std::vector<CatalogPreset>& presets, const std::vector<CatalogEntry>& entries,
+                       juce::uint32 seed, const juce::File& outputDir)
+{
+    juce::Array<juce::var> responses;
+
+    for (const auto& entry : entries)
+    {
+        if (!entry.ok)
+            continue;
+
+        const auto& preset = presets[static_cast<size_t>(entry.preset)];
+
+        juce::Array<juce::var> energy;
+        for (auto db : entry.energyDb)
+            energy.add(db);
+
+        auto* object = new juce::DynamicObject();
+        object->setProperty("name", preset.name);
+        object->setProperty("preset", preset.presetIndex >= 0 ? juce::var(preset.presetIndex) : juce::var("user"));
+        object->setProperty("file", entry.file.getFileName());
+        object->setProperty("sampleRate", entry.sampleRate);
+        object->setProperty("settings", settingsToVar(preset.settings));
+        object->setProperty("rt60", entry.rt60);
+        object->setProperty("edt", entry.edt);
+        object->setProperty("energyDb", energy);
+        responses.add(juce::var(object));
+    }
+
+    auto* root = new juce::DynamicObject();
+    root->setProperty("version", JUCE_APPLICATION_VERSION_STRING);
+    root->setProperty("seed", static_cast<juce::int64>(seed));
+    root->setProperty("channels", juce::Array<juce::var> { "LL", "LR", "RL", "RR" });
+    root->setProperty("responses", responses);
+
+    const auto indexFile = outputDir.getChildFile("index.json");
+    if (!indexFile.replaceWithText(juce::JSON::toString(juce::var(root))))
+        juce::ConsoleApplication::fail("Cannot write " + indexFile.getFullPathName());
+}
+
+//==============================================================================
+void runImpulseCatalog(const juce::ArgumentList& args)
+{
+    const auto presets = collectCatalogPresets(args);
+    const auto rates = parseRates(args);
+
+    const auto outputDir = args.containsOption("--out")
+                         ? args.getFileForOption("--out")
+                         : juce::File::getCurrentWorkingDirectory().getChildFile("CosmosIRs");
+
+    if (!outputDir.createDirectory())
+        juce::ConsoleApplication::fail("Cannot create output directory: " + outputDir.getFullPathName());
+
+    const double lengthSeconds = args.containsOption("--length")
+                               ? juce::jmax(0.1, args.getValueForOption("--length").getDoubleValue())
+                               : -1.0;
+
+    const auto seed = args.containsOption("--seed")
+                    ? static_cast<juce::uint32>(args.getValueForOption("--seed").getLargeIntValue())
+                    : juce::uint32 { 1 };
+
+    // One task per preset and sample rate
+    std::vector<CatalogEntry> entries;
+    for (int p = 0; p < static_cast<int>(presets.size()); ++p)
+        for (auto rate : rates)
+        {
+            CatalogEntry entry;
+            entry.preset = p;
+            entry.sampleRate = rate;
+            entry.file = getImpulseFile(presets[static_cast<size_t>(p)], rate, outputDir);
+            entries.push_back(entry);
+        }
+
+    const int numTasks = static_cast<int>(entries.size());
+
+    int numJobs = juce::SystemStats::getNumCpus();
+    if (args.containsOption("--jobs"))
+        numJobs = args.getValueForOption("--jobs").getIntValue();
+
+    Cosmos::WorkStealingPool pool(juce::jlimit(1, numTasks, numJobs));
+
+    // One renderer and response buffer per worker
+    std::vector<std::unique_ptr<Cosmos::ImpulseRenderer>> renderers;
+    std::vector<juce::AudioBuffer<float>> buffers(static_cast<size_t>(pool.getNumWorkers()));
+    for (int i = 0; i < pool.getNumWorkers(); ++i)
+        renderers.push_back(std::make_unique<Cosmos::ImpulseRenderer>());
+
+    juce::CriticalSection outputLock;
+
+    std::cout << "Rendering " << numTasks << " impulse response(s) on " << pool.getNumWorkers()
+              << " worker(s)" << std::endl;
+
+    const auto startTicks = juce::Time::getHighResolutionTicks();
+
+    pool.parallelFor(numTasks, [&](int taskIndex, int workerIndex)
+    {
+        auto& entry = entries[static_cast<size_t>(taskIndex)];
+        auto& ir = buffers[static_cast<size_t>(workerIndex)];
+        const auto& preset = presets[static_cast<size_t>(entry.preset)];
+
+        renderers[static_cast<size_t>(workerIndex)]->render(
+            preset.settings, entry.sampleRate, seed,
+            lengthSeconds > 0.0 ? lengthSeconds : Cosmos::ImpulseRenderer::getDefaultLengthSeconds(preset.settings),
+            ir);
+
+        const auto edc = Cosmos::DecayAnalysis::energyDecayCurve(ir);
+        const double t30 = Cosmos::DecayAnalysis::t30(edc, entry.sampleRate);
+        entry.rt60 = t30 > 0.0 ? t30 : Cosmos::DecayAnalysis::t20(edc, entry.sampleRate);
+        entry.edt = Cosmos::DecayAnalysis::edt(edc, entry.sampleRate);
+
+        for (int ch = 0; ch < ir.getNumChannels(); ++ch)
+            entry.energyDb[static_cast<size_t>(ch)] = Cosmos::DecayAnalysis::energyDb(ir, ch);
+
+        entry.ok = writeImpulse(ir, entry.sampleRate, entry.file);
+
+        const juce::ScopedLock sl(outputLock);
+
+        if (entry.ok)
+            std::cout << "  " << entry.file.getFileName() << "  RT60 " << juce::String(entry.rt60, 2)
+                      << " s (decay " << juce::String(preset.settings.decay, 1) << " s)" << std::endl;
+        else
+            std::cerr << "  FAILED: cannot write " << entry.file.getFullPathName() << std::endl;
+    });
+
+    writeCatalogIndex(presets, entries, seed, outputDir);
+
+    std::cout << "Catalog written to " << outputDir.getFullPathName() << " in "
+              << juce::String(juce::Time::highResolutionTicksToSeconds(
+                     juce::Time::getHighResolutionTicks() - startTicks), 2) << " s" << std::endl;
+
+    const auto numFailed = std::count_if(entries.begin(), entries.end(), [](const auto& e) { return !e.ok; });
+    if (numFailed > 0)
+        juce::ConsoleApplication::fail(juce::String(static_cast<int>(numFailed)) + " response(s) failed");
+}
+
+} // namespace
+
+//==============================================================================
+int main(int argc, char* argv[])
+{
+    juce::ConsoleApplication app;
+
+    app.addHelpCommand("--help|-h", "Usage: CosmosRender [options] <file|directory>...", false);
+    app.addVersionCommand("--version|-v", juce::String("CosmosRender ") + JUCE_APPLICATION_VERSION_STRING);
+
+    app.addCommand({ "--ir-catalog",
+                     "--ir-catalog [options] [preset|directory]...",
+                     "Export impulse responses of every preset",
+                     "Renders true-stereo impulse responses of all nebula presets and the given user presets "
+                     "at several sample rates, with an index of their measured RT60 and energy.",
+                     runImpulseCatalog });
+
+    app.addDefaultCommand({ "",
+                            "[options] <file|directory>...",
+                            "Render audio files through Cosmos",
+                            "Renders each input through one Cosmos setting, in parallel across cores.",
+                            runBatch });
+
+    return app.findAndRunCommand(argc, argv);
+}
@@ -0,0 +1,233 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <vector>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Decay measurements on rendered impulse responses
+ *
+ * Energy decay curves use Schroeder backward integration from the arrival
+ * of the direct sound, so pre-delay is not part of any fit; decay times are
+ * least-squares fits over an EDC range, extrapolated to 60 dB
+ * (ISO 3382: EDT 0..-10 dB, T20 -5..-25 dB, T30 -5..-35 dB).
+ *
+ * Octave bands are split with an FFT filterbank over the whole response:
+ * each band is a flat passband with raised-cosine edges 1/6 octave wide, so
+ * adjacent bands sum to unity. The FFT is zero-padded to at least twice the
+ * response length, so the filtering is a linear convolution and the
+ * filters' pre-ringing cannot wrap around into the tail.
+ */
+namespace DecayAnalysis
+{
+    // Direct sound arrives at the first sample within this of the peak power
+    constexpr double DirectSoundThresholdDb = 20.0;
+
+    // Index of the first sample of the summed channel power that comes within
+    // DirectSoundThresholdDb of its peak (ISO 3382 start of the response)
+    inline int findDirectSound(const std::vector<double>& power)
+    {
+        if (power.empty())
+            return 0;
+
+        const double threshold = *std::max_element(power.begin(), power.end())
+                               * std::pow(10.0, -DirectSoundThresholdDb / 10.0);
+
+        const auto arrival = std::find_if(power.begin(), power.end(),
+                                          [threshold](double p) { return p > 0.0 && p >= threshold; });
+
+        return arrival != power.end() ? static_cast<int>(arrival - power.begin()) : 0;
+    }
+
+    // Backward-integrated energy of a power signal, in dB re. total energy.
+    // Starts at the direct sound, so index 0 is its arrival.
+    inline std::vector<float> energyDecayCurve(std::vector<double> energy)
+    {
+        energy.erase(energy.begin(), energy.begin() + findDirectSound(energy));
+
+        std::vector<float> edc(energy.size(), -300.0f);
+        double remaining = 0.0;
+
+        for (auto it = energy.rbegin(); it != energy.rend(); ++it)
+        {
+            remaining += *it;
+            *it = remaining;
+        }
+
+        const double total = remaining;
+        if (total <= 0.0)
+            return edc;
+
+        for (size_t i = 0; i < energy.size(); ++i)
+            edc[i] = static_cast<float>(10.0 * std::log10(juce::jmax(energy[i] / total, 1.0e-30)));
+
+        return edc;
+    }
+
+    // Adds the power of one channel to power
+    inline void accumulatePower(const float* data, int numSamples, std::vector<double>& power)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            power[static_cast<size_t>(i)] += static_cast<double>(data[i]) * data[i];
+    }
+
+    // Energy decay curve of the summed channel power
+    inline std::vector<float> energyDecayCurve(const juce::AudioBuffer<float>& ir)
+    {
+        std::vector<double> power(static_cast<size_t>(ir.getNumSamples()), 0.0);
+
+        for (int ch = 0; ch < ir.getNumChannels(); ++ch)
+            accumulatePower(ir.getReadPointer(ch), ir.getNumSamples(), power);
+
+        return energyDecayCurve(std::move(power));
+    }
+
+    // Time to decay 60 dB from a linear fit of the EDC between startDb and endDb.
+    // Returns -1 if the curve never reaches endDb.
+    inline double fitDecayTime(const std::vector<float>& edc, double sampleRate, float startDb, float endDb)
+    {
+        const auto size = static_cast<int>(edc.size());
+
+        int first = 0;
+        while (first < size && edc[static_cast<size_t>(first)] > startDb)
+            ++first;
+
+        int last = first;
+        while (last < size && edc[static_cast<size_t>(last)] > endDb)
+            ++last;
+
+        if (last >= size || last - first < 2)
+            return -1.0;
+
+        // Least-squares slope in dB per sample
+        const double n = static_cast<double>(last - first);
+        double sumX = 0.0, sumY = 0.0, sumXX = 0.0, sumXY = 0.0;
+
+        for (int i = first; i < last; ++i)
+        {
+            const double x = static_cast<double>(i - first);
+            const double y = edc[static_cast<size_t>(i)];
+            sumX += x;
+            sumY += y;
+            sumXX += x * x;
+            sumXY += x * y;
+        }
+
+        const double slope = (n * sumXY - sumX * sumY) / (n * sumXX - sumX * sumX);
+        if (slope >= 0.0)
+            return -1.0;
+
+        return -60.0 / (slope * sampleRate);
+    }
+
+    inline double edt(const std::vector<float>& edc, double sampleRate) { return fitDecayTime(edc, sampleRate, 0.0f, -10.0f); }
+    inline double t20(const std::vector<float>& edc, double sampleRate) { return fitDecayTime(edc, sampleRate, -5.0f, -25.0f); }
+    inline double t30(const std::vector<float>& edc, double sampleRate) { return fitDecayTime(edc, sampleRate, -5.0f, -35.0f); }
+
+    // Total energy of one channel in dB
+    inline double energyDb(const juce::AudioBuffer<float>& ir, int channel)
+    {
+        double sum = 0.0;
+        const float* data = ir.getReadPointer(channel);
+
+        for (int i = 0; i < ir.getNumSamples(); ++i)
+            sum += static_cast<double>(data[i]) * data[i];
+
+        return 10.0 * std::log10(juce::jmax(sum, 1.0e-30));
+    }
+
+    //==========================================================================
+    inline const std::array<double, 7> octaveBandCentres { 125.0, 250.0, 500.0, 1000.0, 2000.0, 4000.0, 8000.0 };
+
+    struct BandDecay
+    {
+        double centreHz = 0.0;
+        double edt = -1.0;
+        double t20 = -1.0;
+        double t30 = -1.0;
+    };
+
+    // Gain of the octave band around centreHz at frequency hz
+    inline float octaveBandWeight(double hz, double centreHz)
+    {
+        constexpr double transition = 1.0 / 6.0;   // octaves
+
+        if (hz <= 0.0)
+            return 0.0f;
+
+        const double distance = std::abs(std::log2(hz / centreHz));
+        const double edgeStart = 0.5 - transition * 0.5;
+
+        if (distance <= edgeStart)
+            return 1.0f;
+
+        if (distance >= edgeStart + transition)
+            return 0.0f;
+
+        const double c = std::cos(juce::MathConstants<double>::halfPi * (distance - edgeStart) / transition);
+        return static_cast<float>(c * c);
+    }
+
+    // Decay times of every octave band (octaveBandCentres) of a response,
+    // summing the energy of all its channels
+    inline std::vector<BandDecay> analyseOctaveBands(const juce::AudioBuffer<float>& ir, double sampleRate)
+    {
+        const int numChannels = ir.getNumChannels();
+        const int numSamples = ir.getNumSamples();
+
+        // Zero-padded to twice the length for linear rather than circular convolution
+        int order = 1;
+        while ((1 << order) < 2 * numSamples)
+            ++order;
+
+        const int fftSize = 1 << order;
+        juce::dsp::FFT fft(order);
+
+        // One band and one channel at a time, in a single transform buffer:
+        // the spectrum is recomputed per band rather than kept per channel,
+        // so memory stays at one padded transform plus one power signal
+        std::vector<float> work(static_cast<size_t>(2 * fftSize));
+        std::vector<double> power(static_cast<size_t>(numSamples));
+        std::vector<BandDecay> results;
+
+        for (auto centre : octaveBandCentres)
+        {
+            if (centre * std::sqrt(2.0) >= sampleRate * 0.5)
+                break;
+
+            std::fill(power.begin(), power.end(), 0.0);
+
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                std::fill(work.begin(), work.end(), 0.0f);
+                std::copy(ir.getReadPointer(ch), ir.getReadPointer(ch) + numSamples, work.begin());
+                fft.performRealOnlyForwardTransform(work.data());
+
+                for (int bin = 0; bin < fftSize; ++bin)
+                {
+                    // Bins above Nyquist mirror the positive frequencies
+                    const int mirrored = bin <= fftSize / 2 ? bin : fftSize - bin;
+                    const float weight = octaveBandWeight(mirrored * sampleRate / fftSize, centre);
+
+                    work[static_cast<size_t>(2 * bin)] *= weight;
+                    work[static_cast<size_t>(2 * bin + 1)] *= weight;
+                }
+
+                fft.performRealOnlyInverseTransform(work.data());
+                accumulatePower(work.data(), numSamples, power);
+            }
+
+            const auto edc = energyDecayCurve(power);
+            results.push_back({ centre, edt(edc, sampleRate), t20(edc, sampleRate), t30(edc, sampleRate) });
+        }
+
+        return results;
+    }
+}
+
+} // namespace Cosmos
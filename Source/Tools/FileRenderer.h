@@ -0,0 +1,371 @@
+#pragma once
+
+#include "../DSP/CosmosEngine.h"
+#include "BlockQueue.h"
+#include "PcmConversion.h"
+#include <juce_audio_formats/juce_audio_formats.h>
+#include <thread>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Options shared by every file of a render job
+ */
+struct RenderOptions
+{
+    CosmosEngine::Settings settings;
+    double tailSeconds = -1.0;      // < 0 = use the engine's tail length
+    int bitsPerSample = 24;
+    int blockSize = 4096;
+
+    bool deterministic = false;     // Seeded, position-addressable modulation
+    juce::uint32 seed = 0;
+};
+
+//==============================================================================
+/**
+ * Part of the output timeline to render
+ *
+ * Output samples [start, end) are written. Before that, the engine is warmed
+ * by processing the preRoll input samples preceding start and discarding the
+ * result, so the tank holds the tail a serial render would have at start.
+ */
+struct RenderSegment
+{
+    juce::int64 start = 0;
+    juce::int64 end = -1;           // < 0 = input length + tail
+    juce::int64 preRoll = 0;
+    int bitsPerSample = 0;          // 0 = RenderOptions::bitsPerSample
+};
+
+//==============================================================================
+/**
+ * Outcome of rendering one file
+ */
+struct RenderResult
+{
+    bool ok = false;
+    bool cached = false;            // served from a RenderCache, no DSP ran
+    juce::String error;
+    double audioSeconds = 0.0;      // rendered output duration, tail included
+    double wallSeconds = 0.0;
+
+    // Busy time of each pipeline stage. The stages overlap, so each is
+    // bounded by wallSeconds; the largest one is the bottleneck.
+    double decodeSeconds = 0.0;
+    double dspSeconds = 0.0;
+    double encodeSeconds = 0.0;
+};
+
+//==============================================================================
+/**
+ * Per-worker file renderer
+ *
+ * Owns one CosmosEngine and a fixed pool of preallocated blocks that is
+ * reused for every file the worker renders, so memory stays flat
+ * regardless of file length.
+ *
+ * Each render runs as a three-stage pipeline:
+ * - a decode thread reads input into free blocks
+ * - the calling thread runs the engine on decoded blocks
+ * - an encode thread converts to PCM and writes, then recycles the block
+ *
+ * Stages hand block indices to each other through lock-free SPSC queues,
+ * so decode and encode overlap the DSP instead of adding to it.
+ */
+class FileRenderer
+{
+public:
+    static constexpr int NumBlocks = 8;
+
+    explicit FileRenderer(const RenderOptions& renderOptions)
+        : options(renderOptions)
+    {
+        formatManager.registerBasicFormats();
+
+        for (int i = 0; i < NumBlocks; ++i)
+        {
+            auto& block = blocks[static_cast<size_t>(i)];
+            block.audio.setSize(2, options.blockSize);
+            block.pcm.allocate(static_cast<size_t>(2 * options.blockSize), true);
+            freeBlocks.push(i);
+        }
+    }
+
+    // Length of the rendered output (input + tail) for an input of the given length
+    static juce::int64 getOutputLength(const RenderOptions& renderOptions,
+                                       juce::int64 inputLength, double sampleRate)
+    {
+        const double tailSeconds = renderOptions.tailSeconds >= 0.0
+                                 ? renderOptions.tailSeconds
+                                 : renderOptions.settings.getTailLengthSeconds();
+
+        return inputLength + static_cast<juce::int64>(tailSeconds * sampleRate);
+    }
+
+    RenderResult render(const juce::File& input, const juce::File& output)
+    {
+        return render(input, output, {});
+    }
+
+    RenderResult render(const juce::File& input, const juce::File& output, const RenderSegment& segment)
+    {
+        RenderResult result;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(input));
+        if (reader == nullptr)
+        {
+            result.error = "cannot read " + input.getFullPathName();
+            return result;
+        }
+
+        engine.setSettings(options.settings);
+
+        const double sampleRate = reader->sampleRate;
+        if (sampleRate != preparedSampleRate)
+        {
+            engine.prepare(sampleRate, options.blockSize);
+            preparedSampleRate = sampleRate;
+        }
+        else
+        {
+            engine.reset();
+        }
+
+        const auto end = segment.end >= 0 ? segment.end
+                                           : getOutputLength(options, reader->lengthInSamples, sampleRate);
+        const auto preRollStart = juce::jmax(static_cast<juce::int64>(0), segment.start - segment.preRoll);
+
+        if (options.deterministic)
+        {
+            engine.setSeed(options.seed);
+            engine.setPosition(preRollStart);
+        }
+
+        auto writer = createWriter(output, sampleRate, segment.bitsPerSample > 0 ? segment.bitsPerSample
+                                                                                 : options.bitsPerSample);
+        if (writer == nullptr)
+        {
+            result.error = "cannot write " + output.getFullPathName();
+            return result;
+        }
+
+        // Blocks before segment.start only warm the tank and are never written
+        bool decodeOk = true;
+        bool encodeOk = true;
+        juce::int64 decodeTicks = 0;
+        juce::int64 encodeTicks = 0;
+
+        std::thread decodeThread([&]
+        {
+            decodeOk = decodeStage(*reader, preRollStart, segment.start, end, decodeTicks);
+        });
+
+        std::thread encodeThread([&]
+        {
+            encodeOk = encodeStage(*writer, segment.start, encodeTicks);
+        });
+
+        const auto dspTicks = processStage();
+
+        decodeThread.join();
+        encodeThread.join();
+        writer.reset();
+
+        if (!decodeOk || !encodeOk)
+        {
+            result.error = (decodeOk ? "write failed for " + output.getFullPathName()
+                                     : "read failed for " + input.getFullPathName());
+            return result;
+        }
+
+        result.ok = true;
+        result.audioSeconds = static_cast<double>(end - segment.start) / sampleRate;
+        result.wallSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+        result.decodeSeconds = juce::Time::highResolutionTicksToSeconds(decodeTicks);
+        result.dspSeconds = juce::Time::highResolutionTicksToSeconds(dspTicks);
+        result.encodeSeconds = juce::Time::highResolutionTicksToSeconds(encodeTicks);
+        return result;
+    }
+
+private:
+    //==========================================================================
+    struct Block
+    {
+        juce::AudioBuffer<float> audio;
+        juce::HeapBlock<int> pcm;       // PCM scratch, channel ch at ch * blockSize
+        juce::int64 position = 0;
+        int numSamples = 0;
+        bool last = false;
+    };
+
+    //==========================================================================
+    // Decode thread: fills free blocks with input from [from, to), zero-padded past the input
+    bool decodeStage(juce::AudioFormatReader& reader, juce::int64 from, juce::int64 split, juce::int64 to,
+                     juce::int64& busyTicks)
+    {
+        bool ok = true;
+        juce::int64 pos = from;
+
+        for (;;)
+        {
+            // Never let a block straddle the end of the pre-roll
+            const auto boundary = pos < split ? split : to;
+            const int numSamples = static_cast<int>(juce::jmin(static_cast<juce::int64>(options.blockSize),
+                                                               boundary - pos));
+
+            const int index = freeBlocks.pop();
+            auto& block = blocks[static_cast<size_t>(index)];
+            block.position = pos;
+            block.numSamples = juce::jmax(0, numSamples);
+            block.last = (pos + block.numSamples >= to);
+
+            const auto t0 = juce::Time::getHighResolutionTicks();
+            ok = readBlock(reader, block) && ok;
+            busyTicks += juce::Time::getHighResolutionTicks() - t0;
+
+            pos += block.numSamples;
+            decodedBlocks.push(index);
+
+            if (block.last)
+                return ok;
+        }
+    }
+
+    // Engine thread (the caller): processes decoded blocks in order
+    juce::int64 processStage()
+    {
+        juce::int64 busyTicks = 0;
+
+        for (;;)
+        {
+            const int index = decodedBlocks.pop();
+            auto& block = blocks[static_cast<size_t>(index)];
+            const bool last = block.last;
+
+            if (block.numSamples > 0)
+            {
+                const auto t0 = juce::Time::getHighResolutionTicks();
+                engine.process(block.audio);
+                busyTicks += juce::Time::getHighResolutionTicks() - t0;
+            }
+
+            processedBlocks.push(index);
+
+            if (last)
+                return busyTicks;
+        }
+    }
+
+    // Encode thread: converts and writes processed blocks, then recycles them
+    bool encodeStage(juce::AudioFormatWriter& writer, juce::int64 writeStart, juce::int64& busyTicks)
+    {
+        bool ok = true;
+
+        for (;;)
+        {
+            const int index = processedBlocks.pop();
+            auto& block = blocks[static_cast<size_t>(index)];
+            const bool last = block.last;
+
+            // Keep draining after a failure so the other stages can finish
+            if (ok && block.numSamples > 0 && block.position >= writeStart)
+            {
+                const auto t0 = juce::Time::getHighResolutionTicks();
+                ok = writeBlock(writer, block);
+                busyTicks += juce::Time::getHighResolutionTicks() - t0;
+            }
+
+            freeBlocks.push(index);
+
+            if (last)
+                return ok;
+        }
+    }
+
+    //==========================================================================
+    // Reads a block, zero-padding past the end of the input and upmixing mono
+    bool readBlock(juce::AudioFormatReader& reader, Block& block)
+    {
+        block.audio.setSize(2, block.numSamples, false, false, true);
+        block.audio.clear();
+
+        const auto available = juce::jmax(static_cast<juce::int64>(0), reader.lengthInSamples - block.position);
+        const int numToRead = static_cast<int>(juce::jmin(static_cast<juce::int64>(block.numSamples), available));
+
+        if (numToRead <= 0)
+            return true;
+
+        if (!reader.read(&block.audio, 0, numToRead, block.position, true, true))
+            return false;
+
+        if (reader.numChannels == 1)
+            block.audio.copyFrom(1, 0, block.audio, 0, 0, numToRead);
+
+        return true;
+    }
+
+    bool writeBlock(juce::AudioFormatWriter& writer, Block& block)
+    {
+        const int* channels[3] = {};
+
+        if (writer.isFloatingPoint())
+        {
+            // Float WAV takes the samples as-is
+            for (int ch = 0; ch < 2; ++ch)
+                channels[ch] = reinterpret_cast<const int*>(block.audio.getReadPointer(ch));
+        }
+        else
+        {
+            for (int ch = 0; ch < 2; ++ch)
+            {
+                int* pcm = block.pcm.get() + ch * options.blockSize;
+                PcmConversion::floatToInt32(block.audio.getReadPointer(ch), pcm, block.numSamples);
+                channels[ch] = pcm;
+            }
+        }
+
+        return writer.write(channels, block.numSamples);
+    }
+
+    std::unique_ptr<juce::AudioFormatWriter> createWriter(const juce::File& output, double sampleRate,
+                                                         int bitsPerSample)
+    {
+        output.deleteFile();
+
+        std::unique_ptr<juce::OutputStream> stream(output.createOutputStream());
+        if (stream == nullptr)
+            return nullptr;
+
+        std::unique_ptr<juce::AudioFormatWriter> writer(wavFormat.createWriterFor(
+            stream.get(), sampleRate, 2, bitsPerSample, {}, 0));
+
+        if (writer != nullptr)
+            stream.release(); // Owned by the writer now
+
+        return writer;
+    }
+
+    //==========================================================================
+    const RenderOptions options;
+
+    CosmosEngine engine;
+    double preparedSampleRate = 0.0;
+
+    juce::AudioFormatManager formatManager;
+    juce::WavAudioFormat wavFormat;
+
+    // Block pool and the queues linking the stages (decode -> dsp -> encode -> decode)
+    std::array<Block, NumBlocks> blocks;
+    BlockQueue<NumBlocks + 1> freeBlocks;
+    BlockQueue<NumBlocks + 1> decodedBlocks;
+    BlockQueue<NumBlocks + 1> processedBlocks;
+
+    JUCE_DECLARE_NON_COPYABLE(FileRenderer)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,95 @@
+#pragma once
+
+#include "../DSP/CosmosEngine.h"
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Renders true-stereo impulse responses of a Cosmos setting
+ *
+ * The engine runs fully wet at unity gain and is excited once per input
+ * channel, giving four responses in the usual true-stereo order:
+ * L->L, L->R, R->L, R->R.
+ *
+ * Modulation is seeded, so the same setting, sample rate and seed always
+ * produce the same response.
+ */
+class ImpulseRenderer
+{
+public:
+    static constexpr int NumChannels = 4;
+
+    explicit ImpulseRenderer(int processingBlockSize = 4096)
+        : blockSize(processingBlockSize)
+    {
+        block.setSize(2, blockSize);
+    }
+
+    // Settings actually rendered: fully wet, unity gain
+    static CosmosEngine::Settings getImpulseSettings(CosmosEngine::Settings settings)
+    {
+        settings.mix = 100.0f;
+        settings.inputGain = 0.0f;
+        settings.outputGain = 0.0f;
+        return settings;
+    }
+
+    // Pre-delay plus 1.5x the decay, so the decay fit has headroom past -60 dB
+    static double getDefaultLengthSeconds(const CosmosEngine::Settings& settings)
+    {
+        return static_cast<double>(settings.preDelay) / 1000.0 + 1.5 * static_cast<double>(settings.decay);
+    }
+
+    void render(const CosmosEngine::Settings& settings, double sampleRate, juce::uint32 seed,
+                double lengthSeconds, juce::AudioBuffer<float>& ir)
+    {
+        const int length = juce::jmax(1, static_cast<int>(lengthSeconds * sampleRate));
+        ir.setSize(NumChannels, length, false, false, true);
+
+        for (int source = 0; source < 2; ++source)
+        {
+            engine.setSettings(getImpulseSettings(settings));
+
+            if (sampleRate != preparedSampleRate)
+            {
+                engine.prepare(sampleRate, blockSize);
+                preparedSampleRate = sampleRate;
+            }
+            else
+            {
+                engine.reset();
+            }
+
+            engine.setSeed(seed);
+            engine.setPosition(0);
+
+            for (int pos = 0; pos < length; pos += blockSize)
+            {
+                const int numSamples = juce::jmin(blockSize, length - pos);
+                block.setSize(2, numSamples, false, false, true);
+                block.clear();
+
+                if (pos == 0)
+                    block.setSample(source, 0, 1.0f);
+
+                engine.process(block);
+
+                for (int ch = 0; ch < 2; ++ch)
+                    ir.copyFrom(source * 2 + ch, pos, block, ch, 0, numSamples);
+            }
+        }
+    }
+
+private:
+    const int blockSize;
+
+    CosmosEngine engine;
+    double preparedSampleRate = 0.0;
+    juce::AudioBuffer<float> block;
+
+    JUCE_DECLARE_NON_COPYABLE(ImpulseRenderer)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+ #include <emmintrin.h>
+ #define COSMOS_PCM_SSE2 1
+#elif defined(__aarch64__) || defined(_M_ARM64)
+ #include <arm_neon.h>
+ #define COSMOS_PCM_NEON 1
+#endif
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Float to PCM conversion for the render writer stage
+ *
+ * Converts float samples to clipped, rounded, left-justified 32-bit
+ * integers - the layout AudioFormatWriter::write() expects - four samples
+ * at a time with SSE2 or NEON. The writer narrows to 16/24 bit itself.
+ */
+namespace PcmConversion
+{
+    // 2^31, and the largest float below it that still fits in an int32
+    constexpr float scale = 2147483648.0f;
+    constexpr float maxScaled = 2147483520.0f;
+
+    inline void floatToInt32(const float* src, int* dst, int numSamples)
+    {
+        int i = 0;
+
+       #if COSMOS_PCM_SSE2
+        const __m128 scaleV = _mm_set1_ps(scale);
+        const __m128 minV = _mm_set1_ps(-scale);
+        const __m128 maxV = _mm_set1_ps(maxScaled);
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            __m128 x = _mm_mul_ps(_mm_loadu_ps(src + i), scaleV);
+            x = _mm_min_ps(_mm_max_ps(x, minV), maxV);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i), _mm_cvtps_epi32(x));
+        }
+       #elif COSMOS_PCM_NEON
+        const float32x4_t minV = vdupq_n_f32(-scale);
+        const float32x4_t maxV = vdupq_n_f32(maxScaled);
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            float32x4_t x = vmulq_n_f32(vld1q_f32(src + i), scale);
+            x = vminq_f32(vmaxq_f32(x, minV), maxV);
+            vst1q_s32(dst + i, vcvtnq_s32_f32(x));
+        }
+       #endif
+
+        for (; i < numSamples; ++i)
+            dst[i] = juce::roundToInt(juce::jlimit(-scale, maxScaled, src[i] * scale));
+    }
+}
+
+} // namespace Cosmos
@@ -0,0 +1,167 @@
+#pragma once
+
+#include "FileRenderer.h"
+#include <juce_cryptography/juce_cryptography.h>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Content-addressed on-disk cache of rendered files
+ *
+ * A render is keyed by the SHA-256 of the input audio bytes, every engine
+ * setting, the render options, the engine version and the modulation seed,
+ * so any change that could alter the output misses the cache.
+ *
+ * Entries are plain WAV files named after their key. A hit refreshes the
+ * entry's modification time, and stores evict the least recently used
+ * entries once the directory exceeds its size budget. Entries are written
+ * to a temporary file and renamed into place, so concurrent jobs sharing a
+ * cache directory never see a partial file.
+ *
+ * Only files named like an entry (64 hex digits and .wav) are ever evicted,
+ * so other files in the directory - including entries still being written -
+ * are left alone. File copies run without the lock held; it only serialises
+ * the recency updates and eviction.
+ */
+class RenderCache
+{
+public:
+    RenderCache(const juce::File& cacheDirectory, juce::int64 maxSizeBytes)
+        : directory(cacheDirectory), maxBytes(maxSizeBytes)
+    {
+    }
+
+    bool initialise() { return directory.createDirectory(); }
+
+    const juce::File& getDirectory() const { return directory; }
+
+    // Returns an empty key if the input cannot be read. variant distinguishes
+    // render modes (e.g. segmented rendering) that change the output.
+    static juce::String computeKey(const juce::File& input, const RenderOptions& options,
+                                   const juce::String& variant = {})
+    {
+        juce::FileInputStream stream(input);
+        if (!stream.openedOk())
+            return {};
+
+        const auto& s = options.settings;
+        juce::MemoryOutputStream description;
+
+        description << juce::SHA256(stream).toHexString()
+                    << "|engine " << CosmosEngine::Version
+                    << "|decay " << s.decay << "|predelay " << s.preDelay
+                    << "|highcut " << s.highCut << "|lowcut " << s.lowCut
+                    << "|mix " << s.mix << "|width " << s.width
+                    << "|thrust " << s.diffusionThrust << "|chaos " << s.modulationChaos
+                    << "|in " << s.inputGain << "|out " << s.outputGain
+                    << "|tail " << options.tailSeconds << "|bits " << options.bitsPerSample
+                    << "|block " << options.blockSize
+                    << "|seed " << (options.deterministic ? juce::String(static_cast<juce::int64>(options.seed))
+                                                          : juce::String("random"))
+                    << "|" << variant;
+
+        return juce::SHA256(description.getMemoryBlock()).toHexString();
+    }
+
+    // Copies a cached render to output. Returns a failed result on a miss.
+    RenderResult fetch(const juce::String& key, const juce::File& output)
+    {
+        RenderResult result;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        const auto entry = getEntryFile(key);
+        if (key.isEmpty() || !entry.existsAsFile())
+            return result;
+
+        std::unique_ptr<juce::AudioFormatReader> reader(wavFormat.createReaderFor(
+            entry.createInputStream().release(), true));
+
+        // Unreadable entries, or ones evicted by another job mid-copy, are
+        // treated as misses and replaced on the next store
+        if (reader == nullptr || !entry.copyFileTo(output))
+            return result;
+
+        {
+            const juce::ScopedLock sl(lock);
+            entry.setLastModificationTime(juce::Time::getCurrentTime());
+        }
+
+        result.ok = true;
+        result.audioSeconds = static_cast<double>(reader->lengthInSamples) / reader->sampleRate;
+        result.wallSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+        return result;
+    }
+
+    // Adds a finished render under key, then evicts down to the size budget
+    bool store(const juce::String& key, const juce::File& rendered)
+    {
+        if (key.isEmpty())
+            return false;
+
+        const auto entry = getEntryFile(key);
+        juce::TemporaryFile temp(entry);
+
+        if (!rendered.copyFileTo(temp.getFile()) || !temp.overwriteTargetFileWithTemporary())
+            return false;
+
+        const juce::ScopedLock sl(lock);
+        evict();
+        return true;
+    }
+
+private:
+    juce::File getEntryFile(const juce::String& key) const
+    {
+        return directory.getChildFile(key + ".wav");
+    }
+
+    // True for names computeKey() produces: 64 hex digits then .wav. This
+    // excludes temporary files, whose names carry a suffix before .wav.
+    static bool isEntryName(const juce::String& fileName)
+    {
+        constexpr int keyLength = 64;
+
+        return fileName.length() == keyLength + 4
+            && fileName.endsWithIgnoreCase(".wav")
+            && fileName.substring(0, keyLength).containsOnly("0123456789abcdefABCDEF");
+    }
+
+    // Deletes least recently used entries until the cache fits the budget
+    void evict()
+    {
+        auto entries = directory.findChildFiles(juce::File::findFiles, false, "*.wav");
+        entries.removeIf([](const juce::File& file) { return !isEntryName(file.getFileName()); });
+
+        juce::int64 total = 0;
+        for (const auto& entry : entries)
+            total += entry.getSize();
+
+        std::sort(entries.begin(), entries.end(), [](const juce::File& a, const juce::File& b)
+        {
+            return a.getLastModificationTime() < b.getLastModificationTime();
+        });
+
+        for (const auto& entry : entries)
+        {
+            if (total <= maxBytes)
+                break;
+
+            const auto size = entry.getSize();
+            if (entry.deleteFile())
+                total -= size;
+        }
+    }
+
+    const juce::File directory;
+    const juce::int64 maxBytes;
+
+    juce::CriticalSection lock;
+    juce::WavAudioFormat wavFormat;
+
+    JUCE_DECLARE_NON_COPYABLE(RenderCache)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "FileRenderer.h"
+#include "WorkStealingPool.h"
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Renders one long file as segments on all workers
+ *
+ * The output timeline is cut into contiguous segments. Each worker renders
+ * its segment to a temporary float WAV, warming its engine first by
+ * pre-rolling the input that precedes the segment for the full tail length,
+ * and renders a short overlap past the segment end. The segments are then
+ * stitched in order with a linear crossfade over that overlap.
+ *
+ * With deterministic modulation the engines agree on the modulation state at
+ * every sample position, so the stitched output is near-identical to a
+ * serial render; without it each segment's modulation starts from its own
+ * random phase and the crossfade hides the seams.
+ */
+class SegmentedRenderer
+{
+public:
+    SegmentedRenderer(const RenderOptions& renderOptions, WorkStealingPool& workerPool,
+                      std::vector<std::unique_ptr<FileRenderer>>& workerRenderers)
+        : options(renderOptions), pool(workerPool), renderers(workerRenderers)
+    {
+        formatManager.registerBasicFormats();
+    }
+
+    void setNumSegments(int numSegmentsToUse) { numSegments = juce::jmax(1, numSegmentsToUse); }
+    void setCrossfadeMs(double ms) { crossfadeMs = juce::jmax(0.0, ms); }
+
+    RenderResult render(const juce::File& input, const juce::File& output)
+    {
+        RenderResult result;
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+
+        double sampleRate = 0.0;
+        juce::int64 inputLength = 0;
+        {
+            std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(input));
+            if (reader == nullptr)
+            {
+                result.error = "cannot read " + input.getFullPathName();
+                return result;
+            }
+            sampleRate = reader->sampleRate;
+            inputLength = reader->lengthInSamples;
+        }
+
+        const auto totalLength = FileRenderer::getOutputLength(options, inputLength, sampleRate);
+        const auto preRoll = static_cast<juce::int64>(options.settings.getTailLengthSeconds() * sampleRate);
+        const auto overlap = static_cast<juce::int64>(crossfadeMs * sampleRate / 1000.0);
+
+        // Segments shorter than the pre-roll would spend most of their time warming up
+        const auto minSegmentLength = juce::jmax(preRoll, static_cast<juce::int64>(10.0 * sampleRate));
+        const int count = static_cast<int>(juce::jlimit(static_cast<juce::int64>(1),
+                                                        static_cast<juce::int64>(numSegments),
+                                                        totalLength / juce::jmax(static_cast<juce::int64>(1),
+                                                                                 minSegmentLength)));
+
+        std::vector<RenderSegment> segments(static_cast<size_t>(count));
+        std::vector<std::unique_ptr<juce::TemporaryFile>> tempFiles;
+
+        for (int i = 0; i < count; ++i)
+        {
+            auto& segment = segments[static_cast<size_t>(i)];
+            segment.start = (totalLength * i) / count;
+            segment.end = (i == count - 1) ? totalLength
+                                           : juce::jmin(totalLength, (totalLength * (i + 1)) / count + overlap);
+            segment.preRoll = preRoll;
+            segment.bitsPerSample = 32;
+
+            tempFiles.push_back(std::make_unique<juce::TemporaryFile>(output));
+        }
+
+        std::vector<RenderResult> segmentResults(segments.size());
+
+        pool.parallelFor(count, [&](int taskIndex, int workerIndex)
+        {
+            segmentResults[static_cast<size_t>(taskIndex)] = renderers[static_cast<size_t>(workerIndex)]->render(
+                input, tempFiles[static_cast<size_t>(taskIndex)]->getFile(), segments[static_cast<size_t>(taskIndex)]);
+        });
+
+        for (const auto& segmentResult : segmentResults)
+        {
+            if (!segmentResult.ok)
+            {
+                result.error = segmentResult.error;
+                return result;
+            }
+
+            result.decodeSeconds += segmentResult.decodeSeconds;
+            result.dspSeconds += segmentResult.dspSeconds;
+            result.encodeSeconds += segmentResult.encodeSeconds;
+        }
+
+        const auto stitchStartTicks = juce::Time::getHighResolutionTicks();
+
+        if (!stitch(tempFiles, output, sampleRate, static_cast<int>(overlap), result.error))
+            return result;
+
+        // Stitching is pure I/O
+        result.encodeSeconds += juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - stitchStartTicks);
+
+        result.ok = true;
+        result.audioSeconds = static_cast<double>(totalLength) / sampleRate;
+        result.wallSeconds = juce::Time::highResolutionTicksToSeconds(
+            juce::Time::getHighResolutionTicks() - startTicks);
+        return result;
+    }
+
+private:
+    bool stitch(const std::vector<std::unique_ptr<juce::TemporaryFile>>& tempFiles, const juce::File& output,
+                double sampleRate, int overlap, juce::String& error)
+    {
+        output.deleteFile();
+
+        std::unique_ptr<juce::OutputStream> stream(output.createOutputStream());
+        std::unique_ptr<juce::AudioFormatWriter> writer;
+
+        if (stream != nullptr)
+        {
+            writer.reset(wavFormat.createWriterFor(stream.get(), sampleRate, 2, options.bitsPerSample, {}, 0));
+            if (writer != nullptr)
+                stream.release();
+        }
+
+        if (writer == nullptr)
+        {
+            error = "cannot write " + output.getFullPathName();
+            return false;
+        }
+
+        juce::AudioBuffer<float> block(2, options.blockSize);
+        juce::AudioBuffer<float> pendingOverlap(2, juce::jmax(1, overlap));
+        bool havePendingOverlap = false;
+
+        for (size_t i = 0; i < tempFiles.size(); ++i)
+        {
+            std::unique_ptr<juce::AudioFormatReader> reader(formatManager.createReaderFor(tempFiles[i]->getFile()));
+            if (reader == nullptr)
+            {
+                error = "cannot read segment " + juce::String(static_cast<int>(i));
+                return false;
+            }
+
+            const bool isLast = (i == tempFiles.size() - 1);
+            const auto length = reader->lengthInSamples;
+            const auto bodyEnd = isLast ? length : juce::jmax(static_cast<juce::int64>(0), length - overlap);
+            juce::int64 pos = 0;
+
+            // Crossfade the previous segment's overlap into the head of this one
+            if (havePendingOverlap)
+            {
+                const int n = static_cast<int>(juce::jmin(static_cast<juce::int64>(overlap), length));
+                block.setSize(2, n, false, false, true);
+                reader->read(&block, 0, n, 0, true, true);
+
+                for (int ch = 0; ch < 2; ++ch)
+                {
+                    block.applyGainRamp(ch, 0, n, 0.0f, 1.0f);
+                    block.addFromWithRamp(ch, 0, pendingOverlap.getReadPointer(ch), n, 1.0f, 0.0f);
+                }
+
+                if (!writer->writeFromAudioSampleBuffer(block, 0, n))
+                {
+                    error = "write failed for " + output.getFullPathName();
+                    return false;
+                }
+
+                pos = n;
+            }
+
+            for (; pos < bodyEnd; pos += options.blockSize)
+            {
+                const int n = static_cast<int>(juce::jmin(static_cast<juce::int64>(options.blockSize), bodyEnd - pos));
+                block.setSize(2, n, false, false, true);
+                reader->read(&block, 0, n, pos, true, true);
+
+                if (!writer->writeFromAudioSampleBuffer(block, 0, n))
+                {
+                    error = "write failed for " + output.getFullPathName();
+                    return false;
+                }
+            }
+
+            havePendingOverlap = !isLast && overlap > 0;
+            if (havePendingOverlap)
+                reader->read(&pendingOverlap, 0, overlap, bodyEnd, true, true);
+        }
+
+        return true;
+    }
+
+    const RenderOptions options;
+    WorkStealingPool& pool;
+    std::vector<std::unique_ptr<FileRenderer>>& renderers;
+
+    int numSegments = 1;
+    double crossfadeMs = 10.0;
+
+    juce::AudioFormatManager formatManager;
+    juce::WavAudioFormat wavFormat;
+
+    JUCE_DECLARE_NON_COPYABLE(SegmentedRenderer)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include "../Utils/Parameters.h"
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Command line parsing shared by the offline tools
+ */
+namespace ToolArguments
+{
+    // Nebula preset from an index or a name; fails the tool on an unknown name
+    inline int parsePreset(const juce::String& text)
+    {
+        if (text.containsOnly("0123456789"))
+            return juce::jlimit(0, NebulaPresets::getNumPresets() - 1, text.getIntValue());
+
+        const int index = NebulaPresets::getNames().indexOf(text, true);
+        if (index < 0)
+            juce::ConsoleApplication::fail("Unknown preset: " + text);
+
+        return index;
+    }
+}
+
+} // namespace Cosmos
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Minimal work-stealing scheduler for offline rendering
+ *
+ * Tasks are dealt out to per-worker queues in contiguous runs. Each worker
+ * drains its own queue from the front and, once empty, steals from the back
+ * of the other queues, so a worker that drew short files picks up the
+ * remaining work of a worker stuck on a long one.
+ *
+ * The task callback receives the worker index, which callers use to pick
+ * per-worker state (engines, buffers) without any locking.
+ */
+class WorkStealingPool
+{
+public:
+    using Task = std::function<void(int taskIndex, int workerIndex)>;
+
+    explicit WorkStealingPool(int numWorkersToUse)
+        : numWorkers(juce::jmax(1, numWorkersToUse)),
+          queues(static_cast<size_t>(numWorkers))
+    {
+    }
+
+    int getNumWorkers() const { return numWorkers; }
+
+    // Runs task(i, worker) for every i in [0, numTasks) and blocks until all are done
+    void parallelFor(int numTasks, const Task& task)
+    {
+        if (numTasks <= 0)
+            return;
+
+        // Deal contiguous runs so neighbouring tasks start on the same worker
+        for (int w = 0; w < numWorkers; ++w)
+        {
+            auto& queue = queues[static_cast<size_t>(w)];
+            const int begin = static_cast<int>((static_cast<juce::int64>(numTasks) * w) / numWorkers);
+            const int end = static_cast<int>((static_cast<juce::int64>(numTasks) * (w + 1)) / numWorkers);
+
+            for (int i = begin; i < end; ++i)
+                queue.tasks.push_back(i);
+        }
+
+        std::vector<std::thread> threads;
+        threads.reserve(static_cast<size_t>(numWorkers - 1));
+
+        for (int w = 1; w < numWorkers; ++w)
+            threads.emplace_back([this, w, &task] { runWorker(w, task); });
+
+        // The calling thread acts as worker 0
+        runWorker(0, task);
+
+        for (auto& t : threads)
+            t.join();
+    }
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex lock;
+        std::deque<int> tasks;
+    };
+
+    void runWorker(int workerIndex, const Task& task)
+    {
+        int taskIndex = 0;
+
+        while (popLocal(workerIndex, taskIndex) || steal(workerIndex, taskIndex))
+            task(taskIndex, workerIndex);
+    }
+
+    bool popLocal(int workerIndex, int& taskIndex)
+    {
+        auto& queue = queues[static_cast<size_t>(workerIndex)];
+        std::lock_guard<std::mutex> guard(queue.lock);
+
+        if (queue.tasks.empty())
+            return false;
+
+        taskIndex = queue.tasks.front();
+        queue.tasks.pop_front();
+        return true;
+    }
+
+    bool steal(int thiefIndex, int& taskIndex)
+    {
+        for (int offset = 1; offset < numWorkers; ++offset)
+        {
+            auto& victim = queues[static_cast<size_t>((thiefIndex + offset) % numWorkers)];
+            std::lock_guard<std::mutex> guard(victim.lock);
+
+            if (!victim.tasks.empty())
+            {
+                taskIndex = victim.tasks.back();
+                victim.tasks.pop_back();
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    const int numWorkers;
+    std::vector<WorkerQueue> queues;
+
+    JUCE_DECLARE_NON_COPYABLE(WorkStealingPool)
+};
+
+} // namespace Cosmos
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include "UiAssetCache.h"
 
 namespace Cosmos
 {
@@ -11,6 +12,9 @@ namespace Cosmos
  *
  * Theme: Deep space, black/blue gradients, glowing readouts
  * Inspired by: Rocket engine dials, spacecraft HUDs
+ *
+ * Rotary dials take their accent from the slider's rotarySliderFillColourId
+ * and draw their static parts from sprites in the shared UiAssetCache.
  */
 class CosmosLookAndFeel : public juce::LookAndFeel_V4
 {
@@ -89,33 +93,19 @@ public:
         auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f;
         auto centreX = bounds.getCentreX();
         auto centreY = bounds.getCentreY();
-        auto rx = centreX - radius;
-        auto ry = centreY - radius;
-        auto rw = radius * 2.0f;
         auto angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
 
-        // Determine accent color based on slider name
-        juce::Colour accentColor = Colors::cosmicBlue;
-        juce::String name = slider.getName().toLowerCase();
+        // Accent is set on the slider by its owner (see EngineKnob)
+        const auto accentColor = slider.findColour(juce::Slider::rotarySliderFillColourId);
 
-        if (name.contains("thrust") || name.contains("diffusion"))
-            accentColor = Colors::thrustOrange;
-        else if (name.contains("chaos") || name.contains("modulation"))
-            accentColor = Colors::chaosViolet;
-        else if (name.contains("fairing"))
-            accentColor = Colors::fairingCyan;
+        // Glow, dial face, ring and ticks don't depend on the value, so they
+        // come from a cached sprite; only the arc and pointer are drawn
+        const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const auto place = juce::AffineTransform::scale(1.0f / pixelScale).translated(static_cast<float>(x),
+                                                                                       static_cast<float>(y));
 
-        // Outer glow
-        g.setColour(accentColor.withAlpha(0.15f));
-        g.fillEllipse(rx - 4, ry - 4, rw + 8, rw + 8);
-
-        // Background circle
-        g.setColour(Colors::dialBackground);
-        g.fillEllipse(rx, ry, rw, rw);
-
-        // Outer ring
-        g.setColour(Colors::dialRing);
-        g.drawEllipse(rx, ry, rw, rw, 2.0f);
+        g.drawImageTransformed(getDialSprite(DialLayer::Body, width, height, rotaryStartAngle, rotaryEndAngle,
+                                             accentColor, pixelScale), place);
 
         // Value arc
         juce::Path valueArc;
@@ -145,29 +135,9 @@ public:
         g.setColour(Colors::starWhite);
         g.fillPath(pointer, juce::AffineTransform::rotation(angle).translated(centreX, centreY));
 
-        // Center dot
-        auto dotRadius = radius * 0.15f;
-        g.setColour(Colors::dialBackground);
-        g.fillEllipse(centreX - dotRadius, centreY - dotRadius, dotRadius * 2, dotRadius * 2);
-        g.setColour(accentColor);
-        g.drawEllipse(centreX - dotRadius, centreY - dotRadius, dotRadius * 2, dotRadius * 2, 1.5f);
-
-        // Tick marks
-        g.setColour(Colors::textDim);
-        int numTicks = 11;
-        for (int i = 0; i < numTicks; ++i)
-        {
-            float tickAngle = rotaryStartAngle + (rotaryEndAngle - rotaryStartAngle) * i / (numTicks - 1);
-            float tickInnerRadius = radius - 2.0f;
-            float tickOuterRadius = radius + 2.0f;
-
-            float x1 = centreX + tickInnerRadius * std::sin(tickAngle);
-            float y1 = centreY - tickInnerRadius * std::cos(tickAngle);
-            float x2 = centreX + tickOuterRadius * std::sin(tickAngle);
-            float y2 = centreY - tickOuterRadius * std::cos(tickAngle);
-
-            g.drawLine(x1, y1, x2, y2, 1.0f);
-        }
+        // Center dot, over the pointer
+        g.drawImageTransformed(getDialSprite(DialLayer::Cap, width, height, rotaryStartAngle, rotaryEndAngle,
+                                             accentColor, pixelScale), place);
     }
 
     //==========================================================================
@@ -319,6 +289,98 @@ public:
     {
         return juce::Font(juce::FontOptions(12.0f));
     }
+
+private:
+    //==========================================================================
+    // Value-independent parts of the rotary dial, rendered once per size,
+    // angles, accent and display scale into the shared asset cache
+    enum class DialLayer
+    {
+        Body,   // Outer glow, face, ring and ticks, under the arc
+        Cap     // Center dot, over the pointer
+    };
+
+    juce::Image getDialSprite(DialLayer layer, int width, int height, float rotaryStartAngle,
+                              float rotaryEndAngle, juce::Colour accentColor, float pixelScale)
+    {
+        juce::String key = layer == DialLayer::Body ? "knob/body/" : "knob/cap/";
+        key << width << "x" << height << "@" << pixelScale << "/" << accentColor.toString()
+            << "/" << rotaryStartAngle << "/" << rotaryEndAngle;
+
+        return assetCache->getOrCreate(key, [=]
+        {
+            juce::Image sprite(juce::Image::ARGB,
+                               juce::jmax(1, juce::roundToInt(width * pixelScale)),
+                               juce::jmax(1, juce::roundToInt(height * pixelScale)), true);
+
+            juce::Graphics g(sprite);
+            g.addTransform(juce::AffineTransform::scale(pixelScale));
+
+            if (layer == DialLayer::Body)
+                drawDialBody(g, width, height, rotaryStartAngle, rotaryEndAngle, accentColor);
+            else
+                drawDialCap(g, width, height, accentColor);
+
+            return sprite;
+        });
+    }
+
+    static void drawDialBody(juce::Graphics& g, int width, int height, float rotaryStartAngle,
+                             float rotaryEndAngle, juce::Colour accentColor)
+    {
+        auto bounds = juce::Rectangle<int>(0, 0, width, height).toFloat().reduced(4.0f);
+        auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f;
+        auto centreX = bounds.getCentreX();
+        auto centreY = bounds.getCentreY();
+        auto rx = centreX - radius;
+        auto ry = centreY - radius;
+        auto rw = radius * 2.0f;
+
+        // Outer glow
+        g.setColour(accentColor.withAlpha(0.15f));
+        g.fillEllipse(rx - 4, ry - 4, rw + 8, rw + 8);
+
+        // Background circle
+        g.setColour(Colors::dialBackground);
+        g.fillEllipse(rx, ry, rw, rw);
+
+        // Outer ring
+        g.setColour(Colors::dialRing);
+        g.drawEllipse(rx, ry, rw, rw, 2.0f);
+
+        // Tick marks
+        g.setColour(Colors::textDim);
+        int numTicks = 11;
+        for (int i = 0; i < numTicks; ++i)
+        {
+            float tickAngle = rotaryStartAngle + (rotaryEndAngle - rotaryStartAngle) * i / (numTicks - 1);
+            float tickInnerRadius = radius - 2.0f;
+            float tickOuterRadius = radius + 2.0f;
+
+            float x1 = centreX + tickInnerRadius * std::sin(tickAngle);
+            float y1 = centreY - tickInnerRadius * std::cos(tickAngle);
+            float x2 = centreX + tickOuterRadius * std::sin(tickAngle);
+            float y2 = centreY - tickOuterRadius * std::cos(tickAngle);
+
+            g.drawLine(x1, y1, x2, y2, 1.0f);
+        }
+    }
+
+    static void drawDialCap(juce::Graphics& g, int width, int height, juce::Colour accentColor)
+    {
+        auto bounds = juce::Rectangle<int>(0, 0, width, height).toFloat().reduced(4.0f);
+        auto radius = juce::jmin(bounds.getWidth(), bounds.getHeight()) / 2.0f;
+        auto centreX = bounds.getCentreX();
+        auto centreY = bounds.getCentreY();
+
+        auto dotRadius = radius * 0.15f;
+        g.setColour(Colors::dialBackground);
+        g.fillEllipse(centreX - dotRadius, centreY - dotRadius, dotRadius * 2, dotRadius * 2);
+        g.setColour(accentColor);
+        g.drawEllipse(centreX - dotRadius, centreY - dotRadius, dotRadius * 2, dotRadius * 2, 1.5f);
+    }
+
+    juce::SharedResourcePointer<UiAssetCache> assetCache;
 };
 
 } // namespace Cosmos
@@ -0,0 +1,3 @@
+#include "CpuMeter.h"
+
+// Implementation is inline in header
@@ -0,0 +1,272 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "CosmosLookAndFeel.h"
+#include "UiAssetCache.h"
+#include "UiSettings.h"
+#include "../Utils/Telemetry.h"
+#include <array>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * CPU Meter
+ *
+ * Cosmos's own processing time as a percentage of the block budget, as a
+ * bar stacked by stage (pre-delay, diffusion, tank, filters, Fairing, I/O)
+ * with a peak-hold marker. The indicator lights when any block used more
+ * than XrunRiskLoad of its budget and stays lit for a few seconds. The
+ * tooltip lists the per-stage figures and the memory held by the shared
+ * UI asset cache. Right-clicking offers the animation frame rate limit and
+ * the starfield's render scale.
+ */
+class CpuMeter : public juce::Component,
+                 public juce::SettableTooltipClient
+{
+public:
+    static constexpr float XrunRiskLoad = 0.7f;
+    static constexpr double PeakHoldMs = 2000.0;
+    static constexpr double RiskHoldMs = 3000.0;
+
+    //==========================================================================
+    CpuMeter()
+    {
+        setOpaque(false);
+        setTooltip(getBreakdownText());
+    }
+
+    // Accumulates one processed block
+    void addFrame(const TelemetryFrame& frame)
+    {
+        const double weight = static_cast<double>(frame.numSamples);
+
+        for (size_t i = 0; i < pendingStageLoad.size(); ++i)
+            pendingStageLoad[i] += frame.stageLoad[i] * weight;
+
+        pendingSamples += weight;
+        pendingMaxLoad = juce::jmax(pendingMaxLoad, frame.cpuLoad);
+    }
+
+    // Publishes the blocks accumulated since the last call
+    void update()
+    {
+        const double now = juce::Time::getMillisecondCounterHiRes();
+
+        if (pendingSamples > 0.0)
+        {
+            totalLoad = 0.0f;
+            for (size_t i = 0; i < stageLoad.size(); ++i)
+            {
+                stageLoad[i] = static_cast<float>(pendingStageLoad[i] / pendingSamples);
+                totalLoad += stageLoad[i];
+            }
+
+            if (pendingMaxLoad >= peakLoad || now - peakTime > PeakHoldMs)
+            {
+                peakLoad = pendingMaxLoad;
+                peakTime = now;
+            }
+
+            if (pendingMaxLoad >= XrunRiskLoad)
+                riskTime = now;
+        }
+        else
+        {
+            // Not processing
+            stageLoad.fill(0.0f);
+            totalLoad = 0.0f;
+
+            if (now - peakTime > PeakHoldMs)
+                peakLoad = 0.0f;
+        }
+
+        pendingStageLoad.fill(0.0);
+        pendingSamples = 0.0;
+        pendingMaxLoad = 0.0f;
+
+        // Repaint only when the readout would change
+        const auto shown = getShownState();
+        if (shown != lastShown)
+        {
+            lastShown = shown;
+            setTooltip(getBreakdownText());
+            repaint();
+        }
+    }
+
+    bool isAtRisk() const
+    {
+        return riskTime > 0.0 && juce::Time::getMillisecondCounterHiRes() - riskTime < RiskHoldMs;
+    }
+
+    //==========================================================================
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat();
+
+        // Readout
+        auto textRow = bounds.removeFromTop(bounds.getHeight() * 0.5f);
+        auto riskArea = textRow.removeFromRight(textRow.getHeight());
+
+        g.setFont(juce::Font(juce::FontOptions(11.0f)));
+        g.setColour(CosmosLookAndFeel::Colors::textSecondary);
+        g.drawText("CPU " + formatPercent(totalLoad) + "  PEAK " + formatPercent(peakLoad),
+                   textRow, juce::Justification::centredRight);
+
+        const bool atRisk = isAtRisk();
+        auto dot = riskArea.withSizeKeepingCentre(7.0f, 7.0f);
+        g.setColour(atRisk ? CosmosLookAndFeel::Colors::meterRed
+                           : CosmosLookAndFeel::Colors::meterGreen.withAlpha(0.6f));
+        g.fillEllipse(dot);
+
+        // Stacked bar: full width is 100% of the block budget
+        auto bar = bounds.reduced(0.0f, 3.0f);
+        g.setColour(CosmosLookAndFeel::Colors::dialBackground.withAlpha(0.8f));
+        g.fillRoundedRectangle(bar, 2.0f);
+
+        float x = bar.getX();
+        for (size_t i = 0; i < stageLoad.size(); ++i)
+        {
+            const float width = bar.getWidth() * juce::jlimit(0.0f, 1.0f, stageLoad[i]);
+            const float clippedWidth = juce::jmin(width, bar.getRight() - x);
+
+            if (clippedWidth > 0.0f)
+            {
+                g.setColour(getStageColour(static_cast<TelemetryStage>(i)));
+                g.fillRect(x, bar.getY(), clippedWidth, bar.getHeight());
+                x += clippedWidth;
+            }
+        }
+
+        // Peak hold
+        const float peakX = bar.getX() + bar.getWidth() * juce::jlimit(0.0f, 1.0f, peakLoad);
+        g.setColour(atRisk ? CosmosLookAndFeel::Colors::meterRed : CosmosLookAndFeel::Colors::starWhite);
+        g.fillRect(peakX - 1.0f, bar.getY() - 1.0f, 2.0f, bar.getHeight() + 2.0f);
+
+        g.setColour(CosmosLookAndFeel::Colors::dialRing);
+        g.drawRoundedRectangle(bar, 2.0f, 1.0f);
+    }
+
+    void mouseDown(const juce::MouseEvent& e) override
+    {
+        if (!e.mods.isPopupMenu())
+            return;
+
+        juce::PopupMenu menu;
+        menu.addSectionHeader("Animation frame rate");
+
+        for (int limit : UiSettings::FrameRateLimits)
+        {
+            menu.addItem(limit == 0 ? juce::String("Display rate") : juce::String(limit) + " fps",
+                         true, settings->getFrameRateLimit() == limit,
+                         [sharedSettings = settings, limit] { sharedSettings->setFrameRateLimit(limit); });
+        }
+
+        menu.addSectionHeader("Starfield resolution");
+
+        for (auto scale : UiSettings::RenderScales)
+        {
+            menu.addItem(UiSettings::getRenderScaleName(scale), true, settings->getRenderScale() == scale,
+                         [sharedSettings = settings, scale] { sharedSettings->setRenderScale(scale); });
+        }
+
+        menu.showMenuAsync(juce::PopupMenu::Options().withTargetComponent(this));
+    }
+
+    //==========================================================================
+    static const char* getStageName(TelemetryStage stage)
+    {
+        switch (stage)
+        {
+            case TelemetryStage::PreDelay:  return "Pre-delay";
+            case TelemetryStage::Diffusion: return "Diffusion";
+            case TelemetryStage::Tank:      return "Tank + modulation";
+            case TelemetryStage::Filters:   return "Filters";
+            case TelemetryStage::Fairing:   return "Fairing";
+            case TelemetryStage::IO:        return "I/O";
+            case TelemetryStage::NumStages:
+            default:                        return "";
+        }
+    }
+
+    static juce::Colour getStageColour(TelemetryStage stage)
+    {
+        switch (stage)
+        {
+            case TelemetryStage::PreDelay:  return CosmosLookAndFeel::Colors::textSecondary;
+            case TelemetryStage::Diffusion: return CosmosLookAndFeel::Colors::thrustOrange;
+            case TelemetryStage::Tank:      return CosmosLookAndFeel::Colors::cosmicBlue;
+            case TelemetryStage::Filters:   return CosmosLookAndFeel::Colors::chaosViolet;
+            case TelemetryStage::Fairing:   return CosmosLookAndFeel::Colors::fairingCyan;
+            case TelemetryStage::IO:        return CosmosLookAndFeel::Colors::textDim;
+            case TelemetryStage::NumStages:
+            default:                        return CosmosLookAndFeel::Colors::textDim;
+        }
+    }
+
+private:
+    static juce::String formatPercent(float load)
+    {
+        return juce::String(load * 100.0f, 1) + "%";
+    }
+
+    // The readout at its displayed resolution: per-stage and peak loads to
+    // 0.1%, and the risk indicator
+    std::array<int, NumTelemetryStages + 2> getShownState() const
+    {
+        std::array<int, NumTelemetryStages + 2> state {};
+
+        for (size_t i = 0; i < stageLoad.size(); ++i)
+            state[i] = juce::roundToInt(stageLoad[i] * 1000.0f);
+
+        state[static_cast<size_t>(NumTelemetryStages)] = juce::roundToInt(peakLoad * 1000.0f);
+        state[static_cast<size_t>(NumTelemetryStages + 1)] = isAtRisk() ? 1 : 0;
+        return state;
+    }
+
+    static juce::String formatMegabytes(juce::int64 bytes)
+    {
+        return juce::String(static_cast<double>(bytes) / (1024.0 * 1024.0), 1);
+    }
+
+    juce::String getBreakdownText() const
+    {
+        juce::String text;
+
+        for (size_t i = 0; i < stageLoad.size(); ++i)
+            text << getStageName(static_cast<TelemetryStage>(i)) << ": " << formatPercent(stageLoad[i]) << "\n";
+
+        text << "Peak block: " << formatPercent(peakLoad);
+
+        if (isAtRisk())
+            text << "\nA block used over " << juce::roundToInt(XrunRiskLoad * 100.0f) << "% of its budget";
+
+        const auto assets = assetCache->getStats();
+        text << "\nUI assets: " << formatMegabytes(assets.bytes) << " of " << formatMegabytes(assets.budgetBytes)
+             << " MB in " << assets.numEntries << " images";
+
+        text << "\nRight-click for frame rate and starfield resolution";
+
+        return text;
+    }
+
+    std::array<double, NumTelemetryStages> pendingStageLoad {};
+    double pendingSamples = 0.0;
+    float pendingMaxLoad = 0.0f;
+
+    std::array<float, NumTelemetryStages> stageLoad {};
+    float totalLoad = 0.0f;
+    float peakLoad = 0.0f;
+    double peakTime = 0.0;
+    double riskTime = 0.0;
+    std::array<int, NumTelemetryStages + 2> lastShown {};
+
+    juce::SharedResourcePointer<UiAssetCache> assetCache;
+    juce::SharedResourcePointer<UiSettings> settings;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(CpuMeter)
+};
+
+} // namespace Cosmos
@@ -2,7 +2,8 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "CosmosLookAndFeel.h"
-#include <array>
+#include "../Utils/Telemetry.h"
+#include <vector>
 
 namespace Cosmos
 {
@@ -11,37 +12,129 @@ namespace Cosmos
 /**
  * Decay Curve Display
  *
- * Shows a visual representation of the reverb decay envelope
- * with animated glow effects.
+ * Scrolling oscilloscope of the reverb tail, built from the per-block
+ * min/max pairs in the telemetry frames. Each column covers an equal
+ * stretch of audio, so the visible span is the decay time; amplitude is on
+ * a mirrored dB scale, so an exponential decay reads as a straight slope.
+ *
+ * The label shows the decay setting and, once an input offset has been
+ * measured, the RT60 estimated from the running signal.
+ *
+ * Columns are drawn once into a cached image that scrolls left as new ones
+ * arrive; a repaint is a single image blit plus the frame and labels.
  */
-class DecayCurveDisplay : public juce::Component,
-                          public juce::Timer
+class DecayCurveDisplay : public juce::Component
 {
 public:
-    static constexpr int HistorySize = 128;
+    static constexpr float FloorDb = -60.0f;
 
     //==========================================================================
     DecayCurveDisplay()
     {
         setOpaque(false);
-        history.fill(0.0f);
-        startTimerHz(30);
+        newColumns.reserve(maxNewColumns);
     }
 
-    ~DecayCurveDisplay() override
+    //==========================================================================
+    void setDecayTime(float seconds)
     {
-        stopTimer();
+        const auto previousText = getTimeText();
+        decayTimeSeconds = juce::jmax(0.1f, seconds);
+
+        if (getTimeText() != previousText)
+            repaint(getTimeLabelArea());
     }
 
-    //==========================================================================
-    void setDecayEnvelope(float envelope)
+    // RT60 measured from the running signal; negative hides it
+    void setMeasuredDecay(float seconds)
     {
-        currentEnvelope = juce::jlimit(0.0f, 1.0f, envelope);
+        const auto previousText = getTimeText();
+        measuredDecaySeconds = seconds;
+
+        if (getTimeText() != previousText)
+            repaint(getTimeLabelArea());
     }
 
-    void setDecayTime(float seconds)
+    void setSampleRate(double newSampleRate)
     {
-        decayTimeSeconds = juce::jmax(0.1f, seconds);
+        if (newSampleRate > 0.0)
+            sampleRate = newSampleRate;
+    }
+
+    // Drops the partly built column and any not yet drawn, e.g. after frames
+    // were dropped, so no column spans a gap
+    void resetPending()
+    {
+        pendingMin = 0.0f;
+        pendingMax = 0.0f;
+        pendingSamples = 0.0;
+        newColumns.clear();
+    }
+
+    // Decimates one block into the pending column
+    void addFrame(const TelemetryFrame& frame)
+    {
+        pendingMin = juce::jmin(pendingMin, frame.tankMin);
+        pendingMax = juce::jmax(pendingMax, frame.tankMax);
+        pendingSamples += frame.numSamples;
+
+        const double samplesPerColumn = getSamplesPerColumn();
+
+        // A block longer than a column fills several columns with its range
+        while (pendingSamples >= samplesPerColumn && newColumns.size() < maxNewColumns)
+        {
+            newColumns.push_back({ pendingMin, pendingMax });
+            pendingSamples -= samplesPerColumn;
+
+            if (pendingSamples < samplesPerColumn)
+            {
+                pendingMin = 0.0f;
+                pendingMax = 0.0f;
+            }
+        }
+
+        // Not being updated (e.g. hidden); restart rather than build a backlog
+        if (newColumns.size() >= maxNewColumns)
+            pendingSamples = 0.0;
+    }
+
+    // Draws the columns completed since the last call into the scope image
+    void update()
+    {
+        if (newColumns.empty() || !scope.isValid())
+        {
+            newColumns.clear();
+            return;
+        }
+
+        const int numNew = juce::jmin(static_cast<int>(newColumns.size()), scope.getWidth());
+        const int width = scope.getWidth();
+        const int height = scope.getHeight();
+
+        // Scroll, then clear the strip the new columns will occupy
+        scope.moveImageSection(0, 0, numNew, 0, width - numNew, height);
+        scope.clear({ width - numNew, 0, numNew, height });
+
+        juce::Graphics g(scope);
+        const float centre = height * 0.5f;
+
+        for (int i = 0; i < numNew; ++i)
+        {
+            const auto& column = newColumns[newColumns.size() - static_cast<size_t>(numNew - i)];
+            const float x = static_cast<float>(width - numNew + i);
+
+            const float top = centre - centre * toProportion(column.max);
+            const float bottom = centre + centre * toProportion(-column.min);
+
+            g.setColour(CosmosLookAndFeel::Colors::cosmicBlue.withAlpha(0.55f));
+            g.fillRect(x, top, 1.0f, juce::jmax(1.0f, bottom - top));
+        }
+
+        newColumns.clear();
+
+        // The labels overlap the graph and reach past it, so they are
+        // repainted whole rather than clipped at its edge
+        repaint(graphArea.getUnion(getTimeLabelArea()).getUnion(getTitleArea()));
     }
 
     //==========================================================================
@@ -57,116 +150,98 @@ public:
         g.setColour(CosmosLookAndFeel::Colors::dialRing);
         g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
 
-        // Draw grid lines
+        // Silence line and -40/-20 dB lines either side of it
+        const auto graph = graphArea.toFloat();
         g.setColour(CosmosLookAndFeel::Colors::textDim.withAlpha(0.2f));
-        for (int i = 1; i < 4; ++i)
-        {
-            float x = bounds.getX() + bounds.getWidth() * i / 4.0f;
-            g.drawVerticalLine(static_cast<int>(x), bounds.getY(), bounds.getBottom());
-        }
-        for (int i = 1; i < 3; ++i)
+        g.drawHorizontalLine(static_cast<int>(graph.getCentreY()), graph.getX(), graph.getRight());
+
+        for (float db : { -40.0f, -20.0f })
         {
-            float y = bounds.getY() + bounds.getHeight() * i / 3.0f;
-            g.drawHorizontalLine(static_cast<int>(y), bounds.getX(), bounds.getRight());
+            const float offset = graph.getHeight() * 0.5f * toProportion(juce::Decibels::decibelsToGain(db));
+            g.drawHorizontalLine(static_cast<int>(graph.getCentreY() - offset), graph.getX(), graph.getRight());
+            g.drawHorizontalLine(static_cast<int>(graph.getCentreY() + offset), graph.getX(), graph.getRight());
         }
 
-        // Draw decay curve
-        juce::Path curvePath;
-        juce::Path glowPath;
+        // Scope history, drawn at the scale it was rendered for
+        if (scope.isValid())
+            g.drawImage(scope, graph);
 
-        float graphWidth = bounds.getWidth() - 8;
-        float graphHeight = bounds.getHeight() - 8;
-        float graphX = bounds.getX() + 4;
-        float graphY = bounds.getY() + 4;
+        // Draw decay time label
+        g.setColour(CosmosLookAndFeel::Colors::textSecondary);
+        g.setFont(juce::Font(juce::FontOptions(11.0f)));
 
-        bool pathStarted = false;
+        g.drawText(getTimeText(), getTimeLabelArea(), juce::Justification::centredRight);
+        g.drawText("DECAY", getTitleArea(), juce::Justification::centredLeft);
+    }
 
-        for (int i = 0; i < HistorySize; ++i)
-        {
-            float x = graphX + (static_cast<float>(i) / (HistorySize - 1)) * graphWidth;
-            float normalizedValue = history[static_cast<size_t>(i)];
-            float y = graphY + graphHeight * (1.0f - normalizedValue);
+    void resized() override
+    {
+        graphArea = getLocalBounds().reduced(6);
 
-            if (!pathStarted)
-            {
-                curvePath.startNewSubPath(x, y);
-                pathStarted = true;
-            }
-            else
-            {
-                curvePath.lineTo(x, y);
-            }
-        }
+        const float scale = juce::Component::getApproximateScaleFactorForComponent(this);
+        const int width = juce::roundToInt(graphArea.getWidth() * scale);
+        const int height = juce::roundToInt(graphArea.getHeight() * scale);
 
-        // Create filled area
-        glowPath = curvePath;
-        glowPath.lineTo(graphX + graphWidth, graphY + graphHeight);
-        glowPath.lineTo(graphX, graphY + graphHeight);
-        glowPath.closeSubPath();
-
-        // Draw glow fill
-        juce::ColourGradient fillGradient(
-            CosmosLookAndFeel::Colors::cosmicBlue.withAlpha(0.3f),
-            0, graphY,
-            CosmosLookAndFeel::Colors::cosmicBlue.withAlpha(0.0f),
-            0, graphY + graphHeight,
-            false);
-        g.setGradientFill(fillGradient);
-        g.fillPath(glowPath);
-
-        // Draw curve line
-        g.setColour(CosmosLookAndFeel::Colors::cosmicBlue);
-        g.strokePath(curvePath, juce::PathStrokeType(2.0f, juce::PathStrokeType::curved,
-                                                      juce::PathStrokeType::rounded));
-
-        // Draw glow on curve
-        g.setColour(CosmosLookAndFeel::Colors::cosmicBlue.withAlpha(0.4f));
-        g.strokePath(curvePath, juce::PathStrokeType(4.0f, juce::PathStrokeType::curved,
-                                                      juce::PathStrokeType::rounded));
-
-        // Draw current value indicator (bright dot at end)
-        float lastX = graphX + graphWidth;
-        float lastY = graphY + graphHeight * (1.0f - history[HistorySize - 1]);
-
-        // Glow
-        g.setColour(CosmosLookAndFeel::Colors::starWhite.withAlpha(0.3f));
-        g.fillEllipse(lastX - 6, lastY - 6, 12, 12);
-
-        // Core
-        g.setColour(CosmosLookAndFeel::Colors::starWhite);
-        g.fillEllipse(lastX - 3, lastY - 3, 6, 6);
+        // History is dropped on resize; the scope refills within one decay time
+        scope = width > 0 && height > 0 ? juce::Image(juce::Image::ARGB, width, height, true) : juce::Image();
+    }
 
-        // Draw decay time label
-        g.setColour(CosmosLookAndFeel::Colors::textSecondary);
-        g.setFont(juce::Font(juce::FontOptions(11.0f)));
+private:
+    struct Column
+    {
+        float min = 0.0f;
+        float max = 0.0f;
+    };
 
+    // Decay setting and measured RT60, at the precision shown
+    juce::String getTimeText() const
+    {
         juce::String timeText = juce::String(decayTimeSeconds, 1) + "s";
-        g.drawText(timeText, bounds.removeFromBottom(16).removeFromRight(40),
-                   juce::Justification::centredRight);
+        if (measuredDecaySeconds > 0.0f)
+            timeText = "measured " + juce::String(measuredDecaySeconds, 1) + "s  /  " + timeText;
 
-        g.drawText("DECAY", bounds.removeFromTop(16).removeFromLeft(60),
-                   juce::Justification::centredLeft);
+        return timeText;
     }
 
-    //==========================================================================
-    void timerCallback() override
+    juce::Rectangle<int> getTimeLabelArea() const
     {
-        // Shift history
-        for (int i = 0; i < HistorySize - 1; ++i)
-        {
-            history[static_cast<size_t>(i)] = history[static_cast<size_t>(i + 1)];
-        }
+        return getLocalBounds().reduced(2).removeFromBottom(16).removeFromRight(160);
+    }
+
+    juce::Rectangle<int> getTitleArea() const
+    {
+        return getLocalBounds().reduced(2).removeFromTop(16).removeFromLeft(60);
+    }
 
-        // Add current value
-        history[HistorySize - 1] = currentEnvelope;
+    // The visible width spans one decay time
+    double getSamplesPerColumn() const
+    {
+        const int columns = scope.isValid() ? scope.getWidth() : 256;
+        return juce::jmax(1.0, sampleRate * decayTimeSeconds / columns);
+    }
+
+    // Amplitude to 0-1 on a dB scale from FloorDb to 0 dBFS
+    static float toProportion(float amplitude)
+    {
+        if (amplitude <= 0.0f)
+            return 0.0f;
 
-        repaint();
+        return juce::jlimit(0.0f, 1.0f, 1.0f - juce::Decibels::gainToDecibels(amplitude, FloorDb) / FloorDb);
     }
 
-private:
-    std::array<float, HistorySize> history;
-    float currentEnvelope = 0.0f;
+    static constexpr size_t maxNewColumns = 4096;
+
+    juce::Image scope;
+    juce::Rectangle<int> graphArea;
+    std::vector<Column> newColumns;
+
+    float pendingMin = 0.0f;
+    float pendingMax = 0.0f;
+    double pendingSamples = 0.0;
+
+    double sampleRate = 48000.0;
     float decayTimeSeconds = 5.0f;
+    float measuredDecaySeconds = -1.0f;
 };
 
 } // namespace Cosmos
@@ -2,6 +2,7 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "CosmosLookAndFeel.h"
+#include "UiAssetCache.h"
 
 namespace Cosmos
 {
@@ -14,6 +15,9 @@ namespace Cosmos
  * - Glowing value arc
  * - Animated glow pulse
  * - Label with value display
+ *
+ * Buffered to an image, so it is only re-rendered when its value changes,
+ * not each time the starfield behind it moves.
  */
 class EngineKnob : public juce::Component
 {
@@ -33,6 +37,7 @@ public:
         slider.setSliderStyle(juce::Slider::RotaryVerticalDrag);
         slider.setTextBoxStyle(juce::Slider::NoTextBox, false, 0, 0);
         slider.setName(labelText);
+        slider.setColour(juce::Slider::rotarySliderFillColourId, getAccentColour(style));
         addAndMakeVisible(slider);
 
         valueLabel.setJustificationType(juce::Justification::centred);
@@ -44,7 +49,15 @@ public:
         nameLabel.setColour(juce::Label::textColourId, CosmosLookAndFeel::Colors::textSecondary);
         addAndMakeVisible(nameLabel);
 
-        slider.onValueChange = [this]() { updateValueLabel(); };
+        // The glow behind the dial follows the value and extends past the
+        // slider, so the whole knob is invalidated
+        slider.onValueChange = [this]()
+        {
+            updateValueLabel();
+            repaint();
+        };
+
+        setBufferedToImage(true);
     }
 
     //==========================================================================
@@ -87,14 +100,8 @@ public:
         auto centerY = sliderBounds.getCentreY();
         auto radius = juce::jmin(sliderBounds.getWidth(), sliderBounds.getHeight()) / 2.0f;
 
-        juce::Colour glowColor;
-        switch (style)
-        {
-            case Style::Thrust:  glowColor = CosmosLookAndFeel::Colors::thrustOrange; break;
-            case Style::Chaos:   glowColor = CosmosLookAndFeel::Colors::chaosViolet; break;
-            case Style::Fairing: glowColor = CosmosLookAndFeel::Colors::fairingCyan; break;
-            default:             glowColor = CosmosLookAndFeel::Colors::cosmicBlue; break;
-        }
+        if (radius <= 0.0f)
+            return;
 
         // Outer glow (subtle pulse based on value)
         float normalizedValue = static_cast<float>(slider.getValue() - slider.getMinimum()) /
@@ -102,16 +109,53 @@ public:
 
         float glowAlpha = 0.05f + normalizedValue * 0.1f;
 
-        juce::ColourGradient glow(
-            glowColor.withAlpha(glowAlpha), centerX, centerY,
-            juce::Colours::transparentBlack, centerX + radius * 1.5f, centerY, true);
+        // The gradient is cached at full strength and faded by the value
+        const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        juce::Graphics::ScopedSaveState state(g);
+        g.setOpacity(glowAlpha);
+        g.drawImageTransformed(getGlowSprite(radius, pixelScale),
+                               juce::AffineTransform::scale(1.0f / pixelScale)
+                                   .translated(centerX - radius * 1.5f, centerY - radius * 1.5f));
+    }
 
-        g.setGradientFill(glow);
-        g.fillEllipse(centerX - radius * 1.5f, centerY - radius * 1.5f,
-                      radius * 3.0f, radius * 3.0f);
+    static juce::Colour getAccentColour(Style knobStyle)
+    {
+        switch (knobStyle)
+        {
+            case Style::Thrust:  return CosmosLookAndFeel::Colors::thrustOrange;
+            case Style::Chaos:   return CosmosLookAndFeel::Colors::chaosViolet;
+            case Style::Fairing: return CosmosLookAndFeel::Colors::fairingCyan;
+            case Style::Standard:
+            default:             return CosmosLookAndFeel::Colors::cosmicBlue;
+        }
     }
 
 private:
+    juce::Image getGlowSprite(float radius, float pixelScale)
+    {
+        const auto glowColor = getAccentColour(style);
+        const juce::String key = "knob/glow/" + juce::String(radius, 2) + "@" + juce::String(pixelScale)
+                               + "/" + glowColor.toString();
+
+        return assetCache->getOrCreate(key, [radius, pixelScale, glowColor]
+        {
+            const float diameter = radius * 3.0f;
+            const int side = juce::jmax(1, juce::roundToInt(diameter * pixelScale));
+            juce::Image sprite(juce::Image::ARGB, side, side, true);
+
+            juce::Graphics g(sprite);
+            g.addTransform(juce::AffineTransform::scale(pixelScale));
+
+            juce::ColourGradient glow(
+                glowColor, diameter * 0.5f, diameter * 0.5f,
+                juce::Colours::transparentBlack, diameter, diameter * 0.5f, true);
+
+            g.setGradientFill(glow);
+            g.fillEllipse(0.0f, 0.0f, diameter, diameter);
+            return sprite;
+        });
+    }
+
     void updateValueLabel()
     {
         juce::String valueText;
@@ -137,6 +181,8 @@ private:
     juce::String valueSuffix;
     int precision = 1;
     Style style;
+
+    juce::SharedResourcePointer<UiAssetCache> assetCache;
 };
 
 } // namespace Cosmos
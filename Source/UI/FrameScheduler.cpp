@@ -0,0 +1,3 @@
+#include "FrameScheduler.h"
+
+// Implementation is inline in header
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Frame Scheduler
+ *
+ * Drives all editor animation from the display's vertical blank, so
+ * telemetry is drained and every animation advances once per displayed
+ * frame, and the repaints they trigger land in the same paint pass.
+ *
+ * The callback receives the real time since the previous frame. After a
+ * stall (e.g. the window was hidden) it is clamped to MaxElapsedSeconds so
+ * animations resume rather than jump.
+ *
+ * The rate adapts to what is worth drawing: vblanks are skipped to honour a
+ * user frame rate limit, the owner drops to IdleFrameRate with setIdle()
+ * when nothing is changing, and no frames run at all while the component
+ * is hidden or its window minimised. onResume is called before the first
+ * frame after such a pause.
+ */
+class FrameScheduler
+{
+public:
+    using Callback = std::function<void(double elapsedSeconds)>;
+
+    static constexpr double MaxElapsedSeconds = 0.25;
+    static constexpr double IdleFrameRate = 10.0;
+
+    //==========================================================================
+    FrameScheduler(juce::Component* componentToDrive, Callback frameCallback)
+        : component(componentToDrive),
+          callback(std::move(frameCallback)),
+          vblank(componentToDrive, [this] { onVBlank(); })
+    {
+    }
+
+    // Frames per second, or 0 to run at the display's rate
+    void setFrameRateLimit(double framesPerSecond)
+    {
+        frameRateLimit = juce::jmax(0.0, framesPerSecond);
+    }
+
+    void setIdle(bool shouldBeIdle)
+    {
+        idle = shouldBeIdle;
+    }
+
+    bool isIdle() const { return idle; }
+
+    std::function<void()> onResume;
+
+private:
+    void onVBlank()
+    {
+        if (isPaused())
+        {
+            paused = true;
+            return;
+        }
+
+        const double now = juce::Time::getMillisecondCounterHiRes() * 0.001;
+
+        if (paused)
+        {
+            paused = false;
+            lastFrameTime = 0.0;
+
+            if (onResume)
+                onResume();
+        }
+
+        // Skip vblanks until the target interval has nearly passed; the
+        // slack keeps a limit equal to the display rate from halving it
+        const double targetRate = idle ? (frameRateLimit > 0.0 ? juce::jmin(frameRateLimit, IdleFrameRate) : IdleFrameRate)
+                                       : frameRateLimit;
+
+        if (lastFrameTime > 0.0 && targetRate > 0.0 && now - lastFrameTime < 0.8 / targetRate)
+            return;
+
+        const double elapsed = lastFrameTime > 0.0 ? juce::jmin(MaxElapsedSeconds, now - lastFrameTime) : 0.0;
+        lastFrameTime = now;
+
+        callback(elapsed);
+    }
+
+    bool isPaused() const
+    {
+        auto* peer = component->getPeer();
+        return peer == nullptr || peer->isMinimised() || !component->isShowing();
+    }
+
+    juce::Component* component;
+    Callback callback;
+
+    double frameRateLimit = 0.0;
+    bool idle = false;
+    bool paused = false;
+    double lastFrameTime = 0.0;
+
+    // Declared last so no vblank arrives after the rest is destroyed
+    juce::VBlankAttachment vblank;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(FrameScheduler)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,3 @@
+#include "NebulaImageLoader.h"
+
+// Implementation is inline in header
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "BinaryData.h"
+#include <array>
+#include <atomic>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Nebula Image Loader
+ *
+ * Decodes the nebula background images on demand on a background thread,
+ * downsampled to the size they will be displayed at. Only the selected
+ * nebula and its neighbours in preset order - the likely next selections
+ * when stepping through presets - are kept decoded.
+ *
+ * The decoded images live only here, so dropping an entry frees them; the
+ * shared UiAssetCache holds the backgrounds composited from them instead.
+ *
+ * request() and getImage() are called from the message thread; a change in
+ * getGeneration() signals that a decode has finished.
+ */
+class NebulaImageLoader
+{
+public:
+    static constexpr int NumNebulae = 11;   // Preset indices 1-11; 0 is Manual
+
+    //==========================================================================
+    NebulaImageLoader() = default;
+
+    ~NebulaImageLoader()
+    {
+        pool.removeAllJobs(true, 5000);
+    }
+
+    // Queues the nebula and its neighbours for decoding at pixel size
+    // (or larger), and releases the images of the others
+    void request(int index, juce::Point<int> size)
+    {
+        if (!isValidIndex(index))
+            return;
+
+        const int next = index % NumNebulae + 1;
+        const int previous = (index + NumNebulae - 2) % NumNebulae + 1;
+
+        {
+            const juce::ScopedLock sl(lock);
+
+            for (int i = 1; i <= NumNebulae; ++i)
+                if (i != index && i != next && i != previous)
+                    getEntry(i) = {};
+        }
+
+        queue(index, size);
+        queue(next, size);
+        queue(previous, size);
+    }
+
+    // The decoded image, or an invalid one while it is still being decoded
+    juce::Image getImage(int index) const
+    {
+        if (!isValidIndex(index))
+            return {};
+
+        const juce::ScopedLock sl(lock);
+        return entries[static_cast<size_t>(index - 1)].image;
+    }
+
+    // Incremented each time a decode finishes
+    int getGeneration() const { return generation.load(std::memory_order_acquire); }
+
+    static bool isValidIndex(int index) { return index > 0 && index <= NumNebulae; }
+
+private:
+    struct Entry
+    {
+        juce::Image image;
+        juce::Point<int> requestedSize;     // Zero when not wanted
+    };
+
+    Entry& getEntry(int index) { return entries[static_cast<size_t>(index - 1)]; }
+
+    void queue(int index, juce::Point<int> size)
+    {
+        {
+            const juce::ScopedLock sl(lock);
+            auto& entry = getEntry(index);
+
+            // Already decoded, or being decoded, at a sufficient size
+            if (entry.requestedSize.x >= size.x && entry.requestedSize.y >= size.y)
+                return;
+
+            entry.requestedSize = size;
+        }
+
+        pool.addJob([this, index, size]
+        {
+            auto image = decode(index, size);
+
+            const juce::ScopedLock sl(lock);
+            auto& entry = getEntry(index);
+
+            // Dropped or superseded while decoding
+            if (entry.requestedSize != size)
+                return;
+
+            entry.image = image;
+            generation.fetch_add(1, std::memory_order_release);
+        });
+    }
+
+    // Decodes and downsamples to the smallest size that still covers size
+    static juce::Image decode(int index, juce::Point<int> size)
+    {
+        int dataSize = 0;
+        const char* data = getImageData(index, dataSize);
+        if (data == nullptr)
+            return {};
+
+        auto image = juce::ImageFileFormat::loadFrom(data, static_cast<size_t>(dataSize));
+        if (!image.isValid())
+            return {};
+
+        // Software pixels can be safely resampled off the message thread
+        image = juce::SoftwareImageType().convert(image);
+
+        const double cover = juce::jmax(size.x / static_cast<double>(image.getWidth()),
+                                        size.y / static_cast<double>(image.getHeight()));
+
+        if (cover < 1.0)
+            image = image.rescaled(juce::jmax(1, juce::roundToInt(image.getWidth() * cover)),
+                                   juce::jmax(1, juce::roundToInt(image.getHeight() * cover)),
+                                   juce::Graphics::highResamplingQuality);
+
+        return image;
+    }
+
+    static const char* getImageData(int index, int& dataSize)
+    {
+        switch (index)
+        {
+            case 1:  dataSize = BinaryData::nebula_pillars_jpgSize;   return BinaryData::nebula_pillars_jpg;
+            case 2:  dataSize = BinaryData::nebula_crab_jpgSize;      return BinaryData::nebula_crab_jpg;
+            case 3:  dataSize = BinaryData::nebula_orion_jpgSize;     return BinaryData::nebula_orion_jpg;
+            case 4:  dataSize = BinaryData::nebula_helix_jpgSize;     return BinaryData::nebula_helix_jpg;
+            case 5:  dataSize = BinaryData::nebula_horsehead_jpgSize; return BinaryData::nebula_horsehead_jpg;
+            case 6:  dataSize = BinaryData::nebula_ring_jpgSize;      return BinaryData::nebula_ring_jpg;
+            case 7:  dataSize = BinaryData::nebula_carina_jpgSize;    return BinaryData::nebula_carina_jpg;
+            case 8:  dataSize = BinaryData::nebula_lagoon_jpgSize;    return BinaryData::nebula_lagoon_jpg;
+            case 9:  dataSize = BinaryData::nebula_veil_jpgSize;      return BinaryData::nebula_veil_jpg;
+            case 10: dataSize = BinaryData::nebula_catseye_pngSize;   return BinaryData::nebula_catseye_png;
+            case 11: dataSize = BinaryData::nebula_tarantula_jpgSize; return BinaryData::nebula_tarantula_jpg;
+            default: dataSize = 0;                                    return nullptr;
+        }
+    }
+
+    juce::CriticalSection lock;
+    std::array<Entry, NumNebulae> entries;
+    std::atomic<int> generation { 0 };
+
+    // Declared last so it is destroyed first, finishing any running decode
+    juce::ThreadPool pool { juce::ThreadPoolOptions{}
+                                .withThreadName("Cosmos nebula decoder")
+                                .withNumberOfThreads(1)
+                                .withDesiredThreadPriority(juce::Thread::Priority::low) };
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(NebulaImageLoader)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,3 @@
+#include "SpectrumAnalyzer.h"
+
+// Implementation is inline in header
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include "CosmosLookAndFeel.h"
+#include "../Utils/AudioFifo.h"
+#include <array>
+#include <vector>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Spectrum Analyzer
+ *
+ * Shows the spectrum of the wet tail on a log-frequency axis. The audio
+ * thread only pushes samples into an AudioFifo; pull() drains it on the
+ * message thread, where the windowed FFT and band binning run.
+ *
+ * Bands are summed in the power domain, so magnitudes never need a square
+ * root: windowing and squaring are vectorised, and only the per-band sums
+ * and their log are scalar.
+ */
+class SpectrumAnalyzer : public juce::Component
+{
+public:
+    static constexpr int FftOrder = 11;
+    static constexpr int FftSize = 1 << FftOrder;
+    static constexpr int NumBands = 64;
+
+    static constexpr float MinFrequency = 20.0f;
+    static constexpr float MaxFrequency = 20000.0f;
+    static constexpr float MinDb = -90.0f;
+    static constexpr float MaxDb = 0.0f;
+
+    //==========================================================================
+    SpectrumAnalyzer()
+        : fft(FftOrder),
+          window(static_cast<size_t>(FftSize)),
+          history(static_cast<size_t>(FftSize), 0.0f),
+          fftData(static_cast<size_t>(FftSize * 2), 0.0f)
+    {
+        setOpaque(false);
+        setInterceptsMouseClicks(false, false);
+
+        juce::dsp::WindowingFunction<float>::fillWindowingTables(
+            window.data(), static_cast<size_t>(FftSize), juce::dsp::WindowingFunction<float>::hann, false);
+
+        // Scales band power so a full-scale sine reads 0 dB
+        float windowSum = 0.0f;
+        for (float w : window)
+            windowSum += w;
+        powerScale = 4.0f / (windowSum * windowSum);
+
+        bandLevels.fill(MinDb);
+        setSampleRate(48000.0);
+    }
+
+    //==========================================================================
+    void setSampleRate(double newSampleRate)
+    {
+        if (newSampleRate <= 0.0 || newSampleRate == sampleRate)
+            return;
+
+        sampleRate = newSampleRate;
+
+        // Log-spaced band edges. Low bands narrower than a bin read the
+        // nearest bin, so the display stays on a true log axis.
+        const float binWidth = static_cast<float>(sampleRate) / static_cast<float>(FftSize);
+        const float maxFrequency = juce::jmin(MaxFrequency, static_cast<float>(sampleRate) * 0.5f);
+
+        for (int band = 0; band <= NumBands; ++band)
+        {
+            const float proportion = static_cast<float>(band) / NumBands;
+            const float frequency = MinFrequency * std::pow(maxFrequency / MinFrequency, proportion);
+            bandEdges[static_cast<size_t>(band)] = juce::jlimit(1, FftSize / 2,
+                                                                juce::roundToInt(frequency / binWidth));
+        }
+    }
+
+    // Drains the FIFO and analyses the most recent FftSize samples; levels
+    // fall at ReleaseDbPerSecond over elapsedSeconds. Returns true if new
+    // audio arrived.
+    bool pull(AudioFifo& fifo, double elapsedSeconds)
+    {
+        const float release = ReleaseDbPerSecond * static_cast<float>(elapsedSeconds);
+
+        bool received = false;
+
+        while (fifo.getNumReady() > 0)
+        {
+            const int numToRead = juce::jmin(FftSize - historyIndex, fifo.getNumReady());
+            historyIndex = (historyIndex + fifo.pull(history.data() + historyIndex, numToRead)) % FftSize;
+            received = true;
+        }
+
+        bool changed = true;
+
+        if (received)
+            analyse(release);
+        else
+            changed = decayLevels(release);
+
+        // Silent and fully decayed: nothing to redraw
+        if (changed)
+            repaint();
+
+        return received;
+    }
+
+    //==========================================================================
+    void paint(juce::Graphics& g) override
+    {
+        auto bounds = getLocalBounds().toFloat().reduced(2);
+
+        // Background
+        g.setColour(CosmosLookAndFeel::Colors::dialBackground.withAlpha(0.6f));
+        g.fillRoundedRectangle(bounds, 4.0f);
+
+        g.setColour(CosmosLookAndFeel::Colors::dialRing);
+        g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
+
+        auto graph = bounds.reduced(4);
+
+        // Decade grid lines
+        g.setColour(CosmosLookAndFeel::Colors::textDim.withAlpha(0.2f));
+        for (float frequency : { 100.0f, 1000.0f, 10000.0f })
+        {
+            const float x = graph.getX() + graph.getWidth() * frequencyToProportion(frequency);
+            g.drawVerticalLine(static_cast<int>(x), graph.getY(), graph.getBottom());
+        }
+
+        // Spectrum
+        juce::Path spectrumPath;
+        spectrumPath.startNewSubPath(graph.getX(), graph.getBottom());
+
+        for (int band = 0; band < NumBands; ++band)
+        {
+            const float x = graph.getX() + graph.getWidth() * (band + 0.5f) / NumBands;
+            const float level = juce::jmap(bandLevels[static_cast<size_t>(band)], MinDb, MaxDb, 0.0f, 1.0f);
+            spectrumPath.lineTo(x, graph.getBottom() - graph.getHeight() * juce::jlimit(0.0f, 1.0f, level));
+        }
+
+        spectrumPath.lineTo(graph.getRight(), graph.getBottom());
+        spectrumPath.closeSubPath();
+
+        juce::ColourGradient fillGradient(
+            CosmosLookAndFeel::Colors::chaosViolet.withAlpha(0.5f),
+            0, graph.getY(),
+            CosmosLookAndFeel::Colors::chaosViolet.withAlpha(0.05f),
+            0, graph.getBottom(),
+            false);
+        g.setGradientFill(fillGradient);
+        g.fillPath(spectrumPath);
+
+        g.setColour(CosmosLookAndFeel::Colors::chaosViolet);
+        g.strokePath(spectrumPath, juce::PathStrokeType(1.5f));
+
+        // Label
+        g.setColour(CosmosLookAndFeel::Colors::textSecondary);
+        g.setFont(juce::Font(juce::FontOptions(11.0f)));
+        g.drawText("TAIL SPECTRUM", bounds.removeFromTop(16).removeFromLeft(100).translated(4.0f, 0.0f),
+                   juce::Justification::centredLeft);
+    }
+
+private:
+    void analyse(float release)
+    {
+        // Unroll the history ring, oldest sample first, and window it
+        const int tail = FftSize - historyIndex;
+        juce::FloatVectorOperations::copy(fftData.data(), history.data() + historyIndex, tail);
+        juce::FloatVectorOperations::copy(fftData.data() + tail, history.data(), historyIndex);
+        juce::FloatVectorOperations::multiply(fftData.data(), window.data(), FftSize);
+
+        fft.performRealOnlyForwardTransform(fftData.data(), true);
+
+        // Interleaved re/im of bins 0 .. FftSize/2, squared in place
+        juce::FloatVectorOperations::multiply(fftData.data(), fftData.data(), FftSize + 2);
+
+        std::array<float, NumBands> newLevels;
+
+        for (int band = 0; band < NumBands; ++band)
+        {
+            const int start = bandEdges[static_cast<size_t>(band)];
+            const int end = juce::jmax(start + 1, bandEdges[static_cast<size_t>(band + 1)]);
+
+            float power = 0.0f;
+            for (int bin = start; bin < end; ++bin)
+                power += fftData[static_cast<size_t>(2 * bin)] + fftData[static_cast<size_t>(2 * bin + 1)];
+
+            newLevels[static_cast<size_t>(band)] = power > 0.0f
+                ? juce::jmax(MinDb, 10.0f * std::log10(power * powerScale))
+                : MinDb;
+        }
+
+        // Instant attack, falling release
+        for (int band = 0; band < NumBands; ++band)
+        {
+            auto& level = bandLevels[static_cast<size_t>(band)];
+            level = juce::jmax(newLevels[static_cast<size_t>(band)], level - release);
+        }
+    }
+
+    // Returns true if any band was still falling
+    bool decayLevels(float release)
+    {
+        bool changed = false;
+
+        for (auto& level : bandLevels)
+        {
+            const float newLevel = juce::jmax(MinDb, level - release);
+            changed = changed || newLevel != level;
+            level = newLevel;
+        }
+
+        return changed;
+    }
+
+    float frequencyToProportion(float frequency) const
+    {
+        const float maxFrequency = juce::jmin(MaxFrequency, static_cast<float>(sampleRate) * 0.5f);
+        return std::log(frequency / MinFrequency) / std::log(maxFrequency / MinFrequency);
+    }
+
+    static constexpr float ReleaseDbPerSecond = 45.0f;
+
+    juce::dsp::FFT fft;
+    std::vector<float> window;
+    std::vector<float> history;
+    std::vector<float> fftData;
+    int historyIndex = 0;
+
+    double sampleRate = 0.0;
+    float powerScale = 1.0f;
+    std::array<int, NumBands + 1> bandEdges {};
+    std::array<float, NumBands> bandLevels {};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(SpectrumAnalyzer)
+};
+
+} // namespace Cosmos
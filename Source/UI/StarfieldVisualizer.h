@@ -2,9 +2,10 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "CosmosLookAndFeel.h"
-#include "BinaryData.h"
-#include <array>
-#include <random>
+#include "NebulaImageLoader.h"
+#include "UiAssetCache.h"
+#include "UiSettings.h"
+#include <vector>
 
 namespace Cosmos
 {
@@ -18,36 +19,40 @@ namespace Cosmos
  * - Star speed responds to modulation chaos
  * - Color shifts during fairing separation
  * - Nebula background images based on selected preset
+ *
+ * Stars are blitted from prerendered disc sprites, tinted by the fill colour,
+ * rather than filled as anti-aliased ellipses one by one. Each frame only
+ * the areas the stars moved through are invalidated, so the controls above
+ * the starfield are only repainted where a star passes behind them.
+ *
+ * Stars are kept as a structure of arrays and moved with vector operations,
+ * with one xorshift generator per visualizer for respawns and wobble, so
+ * the count can be raised with setNumStars() at little update cost.
+ *
+ * At high resolutions the layer can be rendered offscreen at 75% or 50% of
+ * the display's resolution and upscaled, either fixed or chosen in Auto
+ * mode from the measured paint time; the controls above stay native.
+ *
+ * Nebula images are decoded in the background by a NebulaImageLoader,
+ * with the default gradient standing in until they are ready.
+ *
+ * The background - nebula, readability overlay and vignette - is composited
+ * once into an image at the display's pixel density and only rebuilt when
+ * the nebula, size or scale changes, so each frame starts with a plain blit.
+ * Composited backgrounds live in the shared UiAssetCache, so editors with
+ * the same nebula and size share one.
  */
-class StarfieldVisualizer : public juce::Component,
-                            public juce::Timer
+class StarfieldVisualizer : public juce::Component
 {
 public:
-    static constexpr int MaxStars = 100;
-
-    //==========================================================================
-    struct Star
-    {
-        float x = 0.0f;
-        float y = 0.0f;
-        float z = 0.0f;       // Depth (for parallax)
-        float speed = 1.0f;
-        float brightness = 1.0f;
-        float size = 1.0f;
-    };
+    static constexpr int DefaultNumStars = 100;
+    static constexpr int MaxNumStars = 4096;
 
     //==========================================================================
     StarfieldVisualizer()
     {
-        setOpaque(false);
-        initializeStars();
-        loadNebulaImages();
-        startTimerHz(60);
-    }
-
-    ~StarfieldVisualizer() override
-    {
-        stopTimer();
+        setOpaque(true);
+        setNumStars(DefaultNumStars);
     }
 
     //==========================================================================
@@ -72,6 +77,22 @@ public:
         fairingIntensity = juce::jlimit(0.0f, 1.0f, intensity);
     }
 
+    // Stars added are scattered in depth; the first ones are kept
+    void setNumStars(int newNumStars)
+    {
+        newNumStars = juce::jlimit(1, MaxNumStars, newNumStars);
+        const int oldNumStars = getNumStars();
+
+        stars.resize(static_cast<size_t>(newNumStars));
+        noise.resize(static_cast<size_t>(newNumStars));
+        drawnStarBounds.resize(static_cast<size_t>(newNumStars));
+
+        for (int i = oldNumStars; i < newNumStars; ++i)
+            resetStar(i, random.nextFloat());
+    }
+
+    int getNumStars() const { return static_cast<int>(stars.z.size()); }
+
     void setNebulaIndex(int index)
     {
         if (index != currentNebulaIndex)
@@ -84,86 +105,144 @@ public:
     //==========================================================================
     void paint(juce::Graphics& g) override
     {
-        auto bounds = getLocalBounds().toFloat();
+        const auto startTicks = juce::Time::getHighResolutionTicks();
+        const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
 
-        // Check if we have a nebula image to display (index > 0, as 0 is Manual)
-        if (currentNebulaIndex > 0 && currentNebulaIndex <= static_cast<int>(nebulaImages.size()))
+        if (currentRenderScale >= 1.0f)
         {
-            const auto& nebulaImage = nebulaImages[static_cast<size_t>(currentNebulaIndex - 1)];
-            if (nebulaImage.isValid())
-            {
-                // Draw nebula image as background, scaled to fill
-                g.drawImage(nebulaImage, bounds, juce::RectanglePlacement::centred | juce::RectanglePlacement::fillDestination);
+            renderLayer(g, pixelScale);
+        }
+        else
+        {
+            // Render the dirty region into the offscreen layer at reduced
+            // resolution, then upscale just that region into place
+            const float layerScale = pixelScale * currentRenderScale;
+            const int layerWidth = juce::jmax(1, juce::roundToInt(getWidth() * layerScale));
+            const int layerHeight = juce::jmax(1, juce::roundToInt(getHeight() * layerScale));
+
+            if (layer.getWidth() != layerWidth || layer.getHeight() != layerHeight)
+                layer = juce::Image(juce::Image::RGB, layerWidth, layerHeight, true);
 
-                // Add a semi-transparent dark overlay for better UI readability
-                g.setColour(juce::Colours::black.withAlpha(0.4f));
-                g.fillRect(bounds);
-            }
-            else
             {
-                // Fallback to gradient if image not loaded
-                drawDefaultBackground(g, bounds);
+                juce::Graphics layerGraphics(layer);
+                layerGraphics.addTransform(juce::AffineTransform::scale(layerScale));
+                layerGraphics.reduceClipRegion(g.getClipBounds().expanded(2));
+                renderLayer(layerGraphics, layerScale);
             }
+
+            g.setImageResamplingQuality(juce::Graphics::mediumResamplingQuality);
+            g.drawImageTransformed(layer, juce::AffineTransform::scale(static_cast<float>(getWidth()) / layerWidth,
+                                                                       static_cast<float>(getHeight()) / layerHeight));
         }
-        else
+
+        if (renderScaleMode == RenderScale::Auto)
+            adaptRenderScale(juce::Time::highResolutionTicksToSeconds(juce::Time::getHighResolutionTicks() - startTicks));
+    }
+
+    // Fixed layer resolution, or Auto to pick it from the measured paint time
+    void setRenderScale(RenderScale mode)
+    {
+        if (mode == renderScaleMode)
+            return;
+
+        renderScaleMode = mode;
+        averagePaintSeconds = 0.0;
+        lastScaleChangeTime = juce::Time::getMillisecondCounterHiRes();
+
+        switch (mode)
         {
-            // Manual mode or no image - use default space gradient
-            drawDefaultBackground(g, bounds);
+            case RenderScale::ThreeQuarters: setLayerScale(0.75f); break;
+            case RenderScale::Half:          setLayerScale(0.5f); break;
+            case RenderScale::Auto:
+            case RenderScale::Full:
+            default:                         setLayerScale(1.0f); break;
         }
+    }
+
+    void resized() override
+    {
+        background = {};
+        layer = {};
+    }
+
+    //==========================================================================
+    // Moves the stars on by the real time since the last frame
+    void advance(double elapsedSeconds)
+    {
+        if (elapsedSeconds <= 0.0)
+            return;
+
+        updateStars(static_cast<float>(elapsedSeconds));
+        repaintMovedStars();
+    }
+
+private:
+    //==========================================================================
+    // Background, stars and Fairing flash, at pixelScale device pixels per
+    // component pixel
+    void renderLayer(juce::Graphics& g, float pixelScale)
+    {
+        auto bounds = getLocalBounds().toFloat();
+
+        // Nebula, overlay and vignette come from a cache at device resolution,
+        // so this is a single unscaled blit
+        if (!isBackgroundCurrent(pixelScale))
+            rebuildBackground(pixelScale);
+
+        g.drawImageTransformed(background, juce::AffineTransform::scale(1.0f / backgroundScale));
 
         // Draw stars
         float centerX = bounds.getCentreX();
         float centerY = bounds.getCentreY();
 
-        for (const auto& star : stars)
+        // Color based on fairing state; the same for every star this frame
+        juce::Colour starColor = CosmosLookAndFeel::Colors::starWhite;
+        if (fairingActive)
         {
-            // Project 3D position to 2D
-            float scale = 1.0f / (star.z + 0.5f);
-            float screenX = centerX + (star.x - 0.5f) * bounds.getWidth() * scale * 2.0f;
-            float screenY = centerY + (star.y - 0.5f) * bounds.getHeight() * scale * 2.0f;
-
-            // Skip stars outside bounds
-            if (screenX < 0 || screenX > bounds.getWidth() ||
-                screenY < 0 || screenY > bounds.getHeight())
-                continue;
-
-            // Calculate star properties
-            float brightness = star.brightness * (1.0f - star.z) * (0.5f + decayEnvelope * 0.5f);
-            float size = star.size * scale * (1.0f + decayEnvelope * 0.5f);
-
-            // Color based on fairing state
-            juce::Colour starColor = CosmosLookAndFeel::Colors::starWhite;
-            if (fairingActive)
-            {
-                // Shift towards cyan during fairing separation
-                starColor = starColor.interpolatedWith(
-                    CosmosLookAndFeel::Colors::fairingCyan, fairingIntensity * 0.7f);
-            }
-            else if (modulationChaos > 0.5f)
-            {
-                // Subtle violet tint at high chaos
-                starColor = starColor.interpolatedWith(
-                    CosmosLookAndFeel::Colors::chaosViolet, (modulationChaos - 0.5f) * 0.3f);
-            }
+            // Shift towards cyan during fairing separation
+            starColor = starColor.interpolatedWith(
+                CosmosLookAndFeel::Colors::fairingCyan, fairingIntensity * 0.7f);
+        }
+        else if (modulationChaos > 0.5f)
+        {
+            // Subtle violet tint at high chaos
+            starColor = starColor.interpolatedWith(
+                CosmosLookAndFeel::Colors::chaosViolet, (modulationChaos - 0.5f) * 0.3f);
+        }
 
-            // Draw star glow
-            if (brightness > 0.3f && size > 1.5f)
+        // Stars are blitted from disc sprites in device pixels
+        if (starSpriteScale != pixelScale)
+            buildStarSprites(pixelScale);
+
+        {
+            juce::Graphics::ScopedSaveState state(g);
+            g.addTransform(juce::AffineTransform::scale(1.0f / pixelScale));
+
+            const auto clip = g.getClipBounds().toFloat();
+
+            for (size_t i = 0; i < stars.z.size(); ++i)
             {
-                g.setColour(starColor.withAlpha(brightness * 0.2f));
-                g.fillEllipse(screenX - size * 2, screenY - size * 2, size * 4, size * 4);
-            }
+                const auto star = projectStar(i);
 
-            // Draw star core
-            g.setColour(starColor.withAlpha(brightness));
-            g.fillEllipse(screenX - size / 2, screenY - size / 2, size, size);
-        }
+                // Skip stars outside bounds or the region being repainted
+                if (!star.visible || !clip.intersects(star.getBounds() * pixelScale))
+                    continue;
 
-        // Draw subtle vignette
-        juce::ColourGradient vignette(
-            juce::Colours::transparentBlack, centerX, centerY,
-            juce::Colours::black.withAlpha(0.4f), 0, 0, true);
-        g.setGradientFill(vignette);
-        g.fillRect(bounds);
+                const float screenX = star.x * pixelScale;
+                const float screenY = star.y * pixelScale;
+
+                // Draw star glow
+                if (star.hasGlow())
+                {
+                    g.setColour(starColor.withAlpha(star.brightness * 0.2f));
+                    drawStarSprite(g, screenX, screenY, star.size * 4.0f * pixelScale);
+                }
+
+                // Draw star core
+                g.setColour(starColor.withAlpha(star.brightness));
+                drawStarSprite(g, screenX, screenY, star.size * pixelScale);
+            }
+        }
 
         // Draw fairing separation flash effect
         if (fairingIntensity > 0.1f)
@@ -183,16 +262,137 @@ public:
         }
     }
 
-    //==========================================================================
-    void timerCallback() override
+    // Auto mode: steps the layer resolution down when the starfield's paint
+    // time stays above the budget, and back up when the predicted cost at
+    // the next step up would sit well within it
+    void adaptRenderScale(double paintSeconds)
     {
-        updateStars();
+        averagePaintSeconds = averagePaintSeconds > 0.0 ? averagePaintSeconds + (paintSeconds - averagePaintSeconds) * 0.1
+                                                        : paintSeconds;
+
+        const double now = juce::Time::getMillisecondCounterHiRes();
+        if (now - lastScaleChangeTime < RenderScaleHoldMs)
+            return;
+
+        if (averagePaintSeconds > PaintBudgetSeconds && currentRenderScale > 0.5f)
+        {
+            setLayerScale(currentRenderScale > 0.75f ? 0.75f : 0.5f);
+        }
+        else if (currentRenderScale < 1.0f)
+        {
+            // Cost scales with the number of pixels rendered
+            const float nextScale = currentRenderScale < 0.75f ? 0.75f : 1.0f;
+            const double ratio = (nextScale * nextScale) / (currentRenderScale * currentRenderScale);
+
+            if (averagePaintSeconds * ratio < PaintBudgetSeconds * 0.5)
+                setLayerScale(nextScale);
+            else
+                return;
+        }
+        else
+        {
+            return;
+        }
+
+        averagePaintSeconds = 0.0;
+        lastScaleChangeTime = now;
+    }
+
+    void setLayerScale(float newScale)
+    {
+        if (newScale == currentRenderScale)
+            return;
+
+        currentRenderScale = newScale;
+        layer = {};
         repaint();
     }
 
-private:
-    //==========================================================================
-    void drawDefaultBackground(juce::Graphics& g, juce::Rectangle<float> bounds)
+    // The background shows the selected nebula as last decoded
+    bool isBackgroundUpToDate() const
+    {
+        return background.isValid()
+            && backgroundNebulaIndex == currentNebulaIndex
+            && backgroundGeneration == nebulaLoader.getGeneration();
+    }
+
+    bool isBackgroundCurrent(float scale) const
+    {
+        return isBackgroundUpToDate()
+            && backgroundScale == scale
+            && background.getWidth() == juce::jmax(1, juce::roundToInt(getWidth() * scale))
+            && background.getHeight() == juce::jmax(1, juce::roundToInt(getHeight() * scale));
+    }
+
+    // Fetches the background for the current nebula, size and scale from the
+    // shared asset cache, rendering it on a miss; called when one of those
+    // changes or a nebula decode finishes
+    void rebuildBackground(float scale)
+    {
+        const juce::Point<int> pixelSize { juce::jmax(1, juce::roundToInt(getWidth() * scale)),
+                                           juce::jmax(1, juce::roundToInt(getHeight() * scale)) };
+
+        backgroundNebulaIndex = currentNebulaIndex;
+        backgroundScale = scale;
+
+        // Decoding happens in the background; until the image is ready
+        // (index > 0, as 0 is Manual) the default gradient stands in
+        nebulaLoader.request(currentNebulaIndex, pixelSize);
+        backgroundGeneration = nebulaLoader.getGeneration();
+
+        const auto nebulaImage = nebulaLoader.getImage(currentNebulaIndex);
+
+        // Everything the pixels depend on
+        juce::String key = "starfield/" + juce::String(pixelSize.x) + "x" + juce::String(pixelSize.y)
+                         + "@" + juce::String(scale) + "/";
+        key << (nebulaImage.isValid() ? "nebula" + juce::String(currentNebulaIndex) + "/"
+                                            + juce::String(nebulaImage.getWidth()) + "x" + juce::String(nebulaImage.getHeight())
+                                      : juce::String("gradient"));
+
+        background = assetCache->getOrCreate(key, [&]
+        {
+            return renderBackground(nebulaImage, pixelSize, scale);
+        });
+    }
+
+    // Nebula (or gradient), readability overlay and vignette at the
+    // display's pixel density
+    juce::Image renderBackground(const juce::Image& nebulaImage, juce::Point<int> pixelSize, float scale) const
+    {
+        juce::Image image(juce::Image::RGB, pixelSize.x, pixelSize.y, true);
+
+        juce::Graphics g(image);
+        g.addTransform(juce::AffineTransform::scale(scale));
+
+        auto bounds = getLocalBounds().toFloat();
+
+        if (nebulaImage.isValid())
+        {
+            // Draw nebula image as background, scaled to fill
+            g.setImageResamplingQuality(juce::Graphics::highResamplingQuality);
+            g.drawImage(nebulaImage, bounds, juce::RectanglePlacement::centred | juce::RectanglePlacement::fillDestination);
+
+            // Add a semi-transparent dark overlay for better UI readability
+            g.setColour(juce::Colours::black.withAlpha(0.4f));
+            g.fillRect(bounds);
+        }
+        else
+        {
+            // Manual mode or no image - use default space gradient
+            drawDefaultBackground(g, bounds);
+        }
+
+        // Subtle vignette
+        juce::ColourGradient vignette(
+            juce::Colours::transparentBlack, bounds.getCentreX(), bounds.getCentreY(),
+            juce::Colours::black.withAlpha(0.4f), 0, 0, true);
+        g.setGradientFill(vignette);
+        g.fillRect(bounds);
+
+        return image;
+    }
+
+    static void drawDefaultBackground(juce::Graphics& g, juce::Rectangle<float> bounds)
     {
         juce::ColourGradient bgGradient(
             CosmosLookAndFeel::Colors::deepSpace, bounds.getCentreX(), 0,
@@ -202,124 +402,278 @@ private:
         g.fillRect(bounds);
     }
 
-    void loadNebulaImages()
+    // A star's position and appearance on screen, in component coordinates
+    struct ProjectedStar
     {
-        // Load nebula images in order matching preset indices 1-11
-        // Index 0 is Manual (no image)
-        nebulaImages.clear();
+        float x = 0.0f, y = 0.0f;
+        float size = 0.0f;
+        float brightness = 0.0f;
+        bool visible = false;
 
-        // 1: Pillars of Creation
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_pillars_jpg, BinaryData::nebula_pillars_jpgSize));
+        bool hasGlow() const { return brightness > 0.3f && size > 1.5f; }
 
-        // 2: Crab Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_crab_jpg, BinaryData::nebula_crab_jpgSize));
+        // Everything drawn for the star, with a pixel either side for sprite
+        // padding and snapping
+        juce::Rectangle<float> getBounds() const
+        {
+            const float diameter = (hasGlow() ? size * 4.0f : size) + 4.0f;
+            return { x - diameter * 0.5f, y - diameter * 0.5f, diameter, diameter };
+        }
+    };
+
+    ProjectedStar projectStar(size_t i) const
+    {
+        const auto bounds = getLocalBounds().toFloat();
+        ProjectedStar star;
+
+        // Project 3D position to 2D
+        const float z = stars.z[i];
+        const float scale = 1.0f / (z + 0.5f);
+        star.x = bounds.getCentreX() + (stars.x[i] - 0.5f) * bounds.getWidth() * scale * 2.0f;
+        star.y = bounds.getCentreY() + (stars.y[i] - 0.5f) * bounds.getHeight() * scale * 2.0f;
+
+        star.visible = star.x >= 0.0f && star.x <= bounds.getWidth()
+                    && star.y >= 0.0f && star.y <= bounds.getHeight();
+
+        star.brightness = stars.brightness[i] * (1.0f - z) * (0.5f + decayEnvelope * 0.5f);
+        star.size = stars.size[i] * scale * (1.0f + decayEnvelope * 0.5f);
+        return star;
+    }
+
+    // Invalidates where each star was drawn last frame and where it will be
+    // drawn now, so only those areas - and the controls over them - are
+    // repainted. The Fairing flash covers everything, and so does a new
+    // background (e.g. a nebula decode finishing), so those repaint all.
+    void repaintMovedStars()
+    {
+        const bool flashVisible = fairingIntensity > 0.1f;
+        const bool fullRepaint = flashVisible || flashWasVisible || !isBackgroundUpToDate();
+        flashWasVisible = flashVisible;
+
+        // Each star's old and new areas, merged when they overlap. Collecting
+        // stops as soon as the limits are passed, though every star's drawn
+        // area is still recorded for the next frame.
+        const auto totalArea = static_cast<juce::int64>(getWidth()) * getHeight();
+        juce::int64 dirtyArea = 0;
+        bool tooMany = fullRepaint;
+        dirtyStarBounds.clear();
+
+        auto addDirty = [&](juce::Rectangle<int> r)
+        {
+            if (tooMany || r.isEmpty())
+                return;
 
-        // 3: Orion Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_orion_jpg, BinaryData::nebula_orion_jpgSize));
+            dirtyArea += static_cast<juce::int64>(r.getWidth()) * r.getHeight();
+            dirtyStarBounds.push_back(r);
 
-        // 4: Helix Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_helix_jpg, BinaryData::nebula_helix_jpgSize));
+            // Past a point, one large repaint is cheaper than many small ones
+            tooMany = static_cast<int>(dirtyStarBounds.size()) > MaxDirtyRectangles || dirtyArea * 2 > totalArea;
+        };
 
-        // 5: Horsehead Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_horsehead_jpg, BinaryData::nebula_horsehead_jpgSize));
+        for (size_t i = 0; i < stars.z.size(); ++i)
+        {
+            const auto star = projectStar(i);
+            const auto area = star.visible ? star.getBounds().getSmallestIntegerContainer() : juce::Rectangle<int>();
+            const auto& drawn = drawnStarBounds[i];
 
-        // 6: Ring Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_ring_jpg, BinaryData::nebula_ring_jpgSize));
+            if (!drawn.isEmpty() && drawn.intersects(area))
+            {
+                addDirty(drawn.getUnion(area));
+            }
+            else
+            {
+                addDirty(drawn);
+                addDirty(area);
+            }
 
-        // 7: Carina Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_carina_jpg, BinaryData::nebula_carina_jpgSize));
+            drawnStarBounds[i] = area;
+        }
 
-        // 8: Lagoon Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_lagoon_jpg, BinaryData::nebula_lagoon_jpgSize));
+        if (tooMany)
+        {
+            repaint();
+            return;
+        }
 
-        // 9: Veil Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_veil_jpg, BinaryData::nebula_veil_jpgSize));
+        // At most MaxDirtyRectangles here, so merging them stays cheap
+        juce::RectangleList<int> dirty;
+        for (const auto& r : dirtyStarBounds)
+            dirty.add(r);
 
-        // 10: Cat's Eye Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_catseye_png, BinaryData::nebula_catseye_pngSize));
+        dirty.consolidate();
 
-        // 11: Tarantula Nebula
-        nebulaImages.push_back(juce::ImageCache::getFromMemory(
-            BinaryData::nebula_tarantula_jpg, BinaryData::nebula_tarantula_jpgSize));
+        for (const auto& r : dirty)
+            repaint(r);
     }
 
-    void initializeStars()
+    // Anti-aliased disc alpha masks, one per SpriteStep of diameter in
+    // device pixels. Tint and brightness come from the fill colour.
+    void buildStarSprites(float scale)
     {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        starSpriteScale = scale;
+
+        const float maxDiameter = MaxStarDiameter * scale;
+        const int numSprites = static_cast<int>(std::ceil(maxDiameter / SpriteStep)) + 1;
+        starSprites.resize(static_cast<size_t>(numSprites));
 
-        for (auto& star : stars)
+        for (int i = 0; i < numSprites; ++i)
         {
-            resetStar(star, dist(gen));
+            const float diameter = juce::jmax(SpriteStep, i * SpriteStep);
+            const juce::String key = "star/disc/" + juce::String(diameter, 1);
+
+            starSprites[static_cast<size_t>(i)] = assetCache->getOrCreate(key, [diameter]
+            {
+                const int side = static_cast<int>(std::ceil(diameter)) + 2;
+                juce::Image sprite(juce::Image::SingleChannel, side, side, true);
+
+                juce::Graphics g(sprite);
+                g.setColour(juce::Colours::white);
+                g.fillEllipse((side - diameter) * 0.5f, (side - diameter) * 0.5f, diameter, diameter);
+                return sprite;
+            });
         }
     }
 
-    void resetStar(Star& star, float initialZ = 0.0f)
+    // Centred on x, y in device pixels, snapped to the nearest pixel
+    void drawStarSprite(juce::Graphics& g, float x, float y, float diameter) const
+    {
+        const int index = juce::jlimit(0, static_cast<int>(starSprites.size()) - 1,
+                                       juce::roundToInt(diameter / SpriteStep));
+        const auto& sprite = starSprites[static_cast<size_t>(index)];
+
+        g.drawImageAt(sprite, juce::roundToInt(x - sprite.getWidth() * 0.5f),
+                      juce::roundToInt(y - sprite.getHeight() * 0.5f), true);
+    }
+
+    void resetStar(int index, float initialZ = 0.0f)
     {
-        std::random_device rd;
-        std::mt19937 gen(rd());
-        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
-
-        star.x = dist(gen);
-        star.y = dist(gen);
-        star.z = initialZ;
-        star.speed = 0.002f + dist(gen) * 0.008f;
-        star.brightness = 0.3f + dist(gen) * 0.7f;
-        star.size = 1.0f + dist(gen) * 3.0f;
+        const auto i = static_cast<size_t>(index);
+
+        stars.x[i] = random.nextFloat();
+        stars.y[i] = random.nextFloat();
+        stars.z[i] = initialZ;
+        stars.speed[i] = 0.002f + random.nextFloat() * 0.008f;
+        stars.brightness[i] = 0.3f + random.nextFloat() * 0.7f;
+        stars.size[i] = 1.0f + random.nextFloat() * 3.0f;
     }
 
-    void updateStars()
+    void updateStars(float elapsedSeconds)
     {
+        const int numStars = getNumStars();
+
         // Speed modifier based on chaos and fairing
         float speedMod = 1.0f + modulationChaos * 2.0f;
         if (fairingActive)
             speedMod *= (1.0f + fairingIntensity * 3.0f);
 
-        for (auto& star : stars)
+        // Move stars towards viewer (decreasing z)
+        juce::FloatVectorOperations::addWithMultiply(stars.z.data(), stars.speed.data(),
+                                                     -speedMod * elapsedSeconds, numStars);
+
+        // Reset stars that passed the viewer
+        if (juce::FloatVectorOperations::findMinimum(stars.z.data(), numStars) < 0.0f)
         {
-            // Move star towards viewer (decreasing z)
-            star.z -= star.speed * speedMod * 0.016f; // Assuming ~60fps
+            for (int i = 0; i < numStars; ++i)
+                if (stars.z[static_cast<size_t>(i)] < 0.0f)
+                    resetStar(i, 1.0f);
+        }
 
-            // Reset star when it passes the viewer
-            if (star.z < 0.0f)
-            {
-                resetStar(star, 1.0f);
-            }
+        // Add slight wobble based on chaos, keeping stars in bounds
+        if (modulationChaos > 0.3f)
+        {
+            // A random walk: the step grows with the square root of the
+            // frame time, so the drift is independent of frame rate
+            const float wobble = (modulationChaos - 0.3f) * 0.001f
+                               * std::sqrt(elapsedSeconds * ReferenceFrameRate);
 
-            // Add slight wobble based on chaos
-            if (modulationChaos > 0.3f)
+            for (auto* axis : { &stars.x, &stars.y })
             {
-                std::random_device rd;
-                std::mt19937 gen(rd());
-                std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
-
-                float wobble = (modulationChaos - 0.3f) * 0.001f;
-                star.x += dist(gen) * wobble;
-                star.y += dist(gen) * wobble;
+                for (auto& n : noise)
+                    n = random.nextBipolar();
 
-                // Keep in bounds
-                star.x = juce::jlimit(0.0f, 1.0f, star.x);
-                star.y = juce::jlimit(0.0f, 1.0f, star.y);
+                juce::FloatVectorOperations::addWithMultiply(axis->data(), noise.data(), wobble, numStars);
+                juce::FloatVectorOperations::clip(axis->data(), axis->data(), 0.0f, 1.0f, numStars);
             }
         }
     }
 
     //==========================================================================
-    std::array<Star, MaxStars> stars;
-    std::vector<juce::Image> nebulaImages;
+    // Structure of arrays, so updates run as vector operations over each field
+    struct StarArrays
+    {
+        std::vector<float> x, y;
+        std::vector<float> z;       // Depth (for parallax)
+        std::vector<float> speed, brightness, size;
+
+        void resize(size_t numStars)
+        {
+            for (auto* field : { &x, &y, &z, &speed, &brightness, &size })
+                field->resize(numStars);
+        }
+    };
+
+    // xorshift32: one per visualizer, cheap enough to call per star per frame
+    struct Xorshift
+    {
+        explicit Xorshift(juce::uint32 seed) : state(seed != 0 ? seed : 0x9e3779b9u) {}
+
+        juce::uint32 next()
+        {
+            state ^= state << 13;
+            state ^= state >> 17;
+            state ^= state << 5;
+            return state;
+        }
+
+        // [0, 1)
+        float nextFloat() { return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f); }
+
+        // [-1, 1)
+        float nextBipolar() { return nextFloat() * 2.0f - 1.0f; }
+
+        juce::uint32 state;
+    };
+
+    StarArrays stars;
+
+    // Rate the wobble step was tuned at
+    static constexpr float ReferenceFrameRate = 60.0f;
+
+    // Largest glow: max size 4, nearest depth 2x, full envelope 1.5x, glow 4x
+    static constexpr float MaxStarDiameter = 4.0f * 2.0f * 1.5f * 4.0f;
+    static constexpr float SpriteStep = 0.5f;
+
+    std::vector<juce::Image> starSprites;
+    float starSpriteScale = 0.0f;
+
+    // Offscreen layer for reduced render scales
+    static constexpr double PaintBudgetSeconds = 0.004;
+    static constexpr double RenderScaleHoldMs = 1000.0;
+
+    RenderScale renderScaleMode = RenderScale::Auto;
+    float currentRenderScale = 1.0f;
+    double averagePaintSeconds = 0.0;
+    double lastScaleChangeTime = 0.0;
+    juce::Image layer;
+
+    // Where each star was last invalidated, for dirty-region repaints
+    static constexpr int MaxDirtyRectangles = 128;
+    std::vector<juce::Rectangle<int>> drawnStarBounds;
+    std::vector<juce::Rectangle<int>> dirtyStarBounds;
+    bool flashWasVisible = false;
+    std::vector<float> noise;
+    Xorshift random { static_cast<juce::uint32>(juce::Random::getSystemRandom().nextInt()) };
+
+    NebulaImageLoader nebulaLoader;
     int currentNebulaIndex = 0;
 
+    // Composited background at device resolution, shared between editors
+    juce::SharedResourcePointer<UiAssetCache> assetCache;
+    juce::Image background;
+    int backgroundNebulaIndex = -1;
+    int backgroundGeneration = -1;
+    float backgroundScale = 0.0f;
+
     float decayEnvelope = 0.0f;
     float modulationChaos = 0.0f;
     bool fairingActive = false;
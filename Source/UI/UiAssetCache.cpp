@@ -0,0 +1,3 @@
+#include "UiAssetCache.h"
+
+// Implementation is inline in header
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <functional>
+#include <map>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Process-wide cache of rendered UI assets
+ *
+ * Composited starfield backgrounds, star sprites and knob sprite atlases
+ * are the same for every editor showing them at the same
+ * size, so all editors share one cache. Hold it with
+ * juce::SharedResourcePointer<UiAssetCache>; it is created with the first
+ * editor and freed with the last.
+ *
+ * Entries are keyed by a string describing everything the pixels depend on.
+ * Once the cached images exceed the byte budget, the least recently used
+ * are dropped. Images are reference counted, so an evicted image stays
+ * valid for anyone still holding it; it just stops being shared.
+ *
+ * Decoded nebula sources are deliberately not cached here: the
+ * NebulaImageLoader frees them with its entries, and the budget only has to
+ * cover a few composited backgrounds (a 1200x800 editor at 2x is ~15 MB).
+ *
+ * Thread safe, so assets may also be rendered off the message thread.
+ */
+class UiAssetCache
+{
+public:
+    static constexpr juce::int64 DefaultBudgetBytes = 32 * 1024 * 1024;
+
+    struct Stats
+    {
+        juce::int64 bytes = 0;
+        juce::int64 budgetBytes = 0;
+        int numEntries = 0;
+        juce::int64 hits = 0;
+        juce::int64 misses = 0;
+        juce::int64 evictions = 0;
+    };
+
+    //==========================================================================
+    UiAssetCache() = default;
+
+    // Returns an invalid image on a miss
+    juce::Image find(const juce::String& key)
+    {
+        const juce::ScopedLock sl(lock);
+
+        auto it = entries.find(key);
+        if (it == entries.end())
+        {
+            ++stats.misses;
+            return {};
+        }
+
+        ++stats.hits;
+        it->second.lastUse = ++useCounter;
+        return it->second.image;
+    }
+
+    void store(const juce::String& key, const juce::Image& image)
+    {
+        if (!image.isValid())
+            return;
+
+        const juce::ScopedLock sl(lock);
+
+        auto& entry = entries[key];
+        stats.bytes += getImageBytes(image) - getImageBytes(entry.image);
+        entry.image = image;
+        entry.lastUse = ++useCounter;
+
+        evict();
+    }
+
+    // Looks up key, rendering and storing the asset on a miss. create runs
+    // without the lock held, so it may be slow.
+    juce::Image getOrCreate(const juce::String& key, const std::function<juce::Image()>& create)
+    {
+        auto image = find(key);
+        if (image.isValid())
+            return image;
+
+        image = create();
+        store(key, image);
+        return image;
+    }
+
+    //==========================================================================
+    void setBudget(juce::int64 bytes)
+    {
+        const juce::ScopedLock sl(lock);
+        budgetBytes = juce::jmax(static_cast<juce::int64>(0), bytes);
+        evict();
+    }
+
+    juce::int64 getMemoryUsage() const
+    {
+        const juce::ScopedLock sl(lock);
+        return stats.bytes;
+    }
+
+    Stats getStats() const
+    {
+        const juce::ScopedLock sl(lock);
+
+        auto result = stats;
+        result.budgetBytes = budgetBytes;
+        result.numEntries = static_cast<int>(entries.size());
+        return result;
+    }
+
+    static juce::int64 getImageBytes(const juce::Image& image)
+    {
+        if (!image.isValid())
+            return 0;
+
+        const int bytesPerPixel = image.isARGB() ? 4 : (image.isRGB() ? 3 : 1);
+        return static_cast<juce::int64>(image.getWidth()) * image.getHeight() * bytesPerPixel;
+    }
+
+private:
+    struct Entry
+    {
+        juce::Image image;
+        juce::uint64 lastUse = 0;
+    };
+
+    // Drops least recently used entries until the cache fits the budget
+    void evict()
+    {
+        while (stats.bytes > budgetBytes && !entries.empty())
+        {
+            auto oldest = entries.begin();
+            for (auto it = entries.begin(); it != entries.end(); ++it)
+                if (it->second.lastUse < oldest->second.lastUse)
+                    oldest = it;
+
+            stats.bytes -= getImageBytes(oldest->second.image);
+            ++stats.evictions;
+            entries.erase(oldest);
+        }
+    }
+
+    juce::CriticalSection lock;
+    std::map<juce::String, Entry> entries;
+    juce::int64 budgetBytes = DefaultBudgetBytes;
+    juce::uint64 useCounter = 0;
+    Stats stats;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiAssetCache)
+};
+
+} // namespace Cosmos
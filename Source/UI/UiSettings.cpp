@@ -0,0 +1,3 @@
+#include "UiSettings.h"
+
+// Implementation is inline in header
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <array>
+
+namespace Cosmos
+{
+
+//==============================================================================
+// Resolution of the starfield layer relative to the display
+enum class RenderScale
+{
+    Auto,           // Chosen from the measured paint time
+    Full,
+    ThreeQuarters,
+    Half
+};
+
+//==============================================================================
+/**
+ * User preferences for the editor, shared by every instance in the process
+ * and kept in a settings file rather than in the plugin state, so they
+ * follow the user rather than the session.
+ *
+ * Hold it with juce::SharedResourcePointer<UiSettings>. Message thread only.
+ */
+class UiSettings
+{
+public:
+    // Animation frame rate caps offered to the user; 0 is the display rate
+    static constexpr std::array<int, 4> FrameRateLimits { 0, 60, 30, 15 };
+
+    static constexpr std::array<RenderScale, 4> RenderScales { RenderScale::Auto, RenderScale::Full,
+                                                               RenderScale::ThreeQuarters, RenderScale::Half };
+
+    //==========================================================================
+    UiSettings()
+    {
+        juce::PropertiesFile::Options options;
+        options.applicationName = "Cosmos";
+        options.folderName = "SeshNx";
+        options.filenameSuffix = ".settings";
+        options.osxLibrarySubFolder = "Application Support";
+
+        properties = std::make_unique<juce::PropertiesFile>(options);
+        frameRateLimit = juce::jmax(0, properties->getIntValue(frameRateLimitKey, 0));
+        renderScale = static_cast<RenderScale>(juce::jlimit(0, static_cast<int>(RenderScale::Half),
+                                                            properties->getIntValue(renderScaleKey, 0)));
+    }
+
+    // Frames per second, or 0 for no limit beyond the display's own rate
+    int getFrameRateLimit() const { return frameRateLimit; }
+
+    void setFrameRateLimit(int framesPerSecond)
+    {
+        frameRateLimit = juce::jmax(0, framesPerSecond);
+        properties->setValue(frameRateLimitKey, frameRateLimit);
+        properties->saveIfNeeded();
+    }
+
+    RenderScale getRenderScale() const { return renderScale; }
+
+    void setRenderScale(RenderScale newScale)
+    {
+        renderScale = newScale;
+        properties->setValue(renderScaleKey, static_cast<int>(renderScale));
+        properties->saveIfNeeded();
+    }
+
+    static juce::String getRenderScaleName(RenderScale scale)
+    {
+        switch (scale)
+        {
+            case RenderScale::Auto:          return "Auto";
+            case RenderScale::Full:          return "Full";
+            case RenderScale::ThreeQuarters: return "75%";
+            case RenderScale::Half:          return "50%";
+            default:                         return {};
+        }
+    }
+
+private:
+    static constexpr const char* frameRateLimitKey = "frameRateLimit";
+    static constexpr const char* renderScaleKey = "starfieldRenderScale";
+
+    std::unique_ptr<juce::PropertiesFile> properties;
+    int frameRateLimit = 0;
+    RenderScale renderScale = RenderScale::Auto;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(UiSettings)
+};
+
+} // namespace Cosmos
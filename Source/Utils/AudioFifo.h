@@ -0,0 +1,86 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <vector>
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Single-producer / single-consumer mono sample FIFO
+ *
+ * Carries audio from the audio thread to the message thread for analysis.
+ * push() is wait-free and mixes the channels down to mono while writing;
+ * a block that does not fit is dropped whole, so the consumer never sees a
+ * block spliced mid-way.
+ */
+class AudioFifo
+{
+public:
+    explicit AudioFifo(int capacity)
+        : fifo(capacity), samples(static_cast<size_t>(capacity), 0.0f)
+    {
+    }
+
+    // Audio thread
+    void push(const float* const* channels, int numChannels, int numSamples) noexcept
+    {
+        if (numChannels <= 0 || numSamples <= 0 || fifo.getFreeSpace() < numSamples)
+            return;
+
+        const auto scope = fifo.write(numSamples);
+        writeMono(channels, numChannels, 0, scope.startIndex1, scope.blockSize1);
+        writeMono(channels, numChannels, scope.blockSize1, scope.startIndex2, scope.blockSize2);
+    }
+
+    // Message thread: reads up to maxSamples, returns the number read
+    int pull(float* dest, int maxSamples)
+    {
+        const auto scope = fifo.read(juce::jmin(maxSamples, fifo.getNumReady()));
+
+        if (scope.blockSize1 > 0)
+            juce::FloatVectorOperations::copy(dest, samples.data() + scope.startIndex1, scope.blockSize1);
+
+        if (scope.blockSize2 > 0)
+            juce::FloatVectorOperations::copy(dest + scope.blockSize1, samples.data() + scope.startIndex2,
+                                              scope.blockSize2);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    // Message thread: drops everything queued so far
+    void discard()
+    {
+        fifo.read(fifo.getNumReady());
+    }
+
+    int getNumReady() const { return fifo.getNumReady(); }
+
+private:
+    void writeMono(const float* const* channels, int numChannels, int sourceOffset,
+                   int destIndex, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return;
+
+        float* dest = samples.data() + destIndex;
+
+        if (numChannels == 1)
+        {
+            juce::FloatVectorOperations::copy(dest, channels[0] + sourceOffset, numSamples);
+        }
+        else
+        {
+            juce::FloatVectorOperations::add(dest, channels[0] + sourceOffset, channels[1] + sourceOffset, numSamples);
+            juce::FloatVectorOperations::multiply(dest, 0.5f, numSamples);
+        }
+    }
+
+    juce::AbstractFifo fifo;
+    std::vector<float> samples;
+
+    JUCE_DECLARE_NON_COPYABLE(AudioFifo)
+};
+
+} // namespace Cosmos
@@ -0,0 +1,3 @@
+#include "DecayEstimator.h"
+
+// Implementation is inline in header for performance
@@ -0,0 +1,161 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "Telemetry.h"
+
+namespace Cosmos
+{
+
+//==============================================================================
+/**
+ * Online RT60 estimate from the running signal
+ *
+ * Watches the telemetry frames for input offsets - input falling silent
+ * after a passage of signal - and fits a line to the tank's log energy as
+ * the tail then decays, over the same -5 to -25 dB range as an offline T20.
+ * The fit is least squares, kept as running sums, so no history is stored.
+ * If the input returns before the full range is covered, a fit over at
+ * least MinFitRangeDb is still accepted.
+ *
+ * Runs on the message thread; the audio thread only publishes frames.
+ */
+class DecayEstimator
+{
+public:
+    static constexpr float SilenceDb = -70.0f;        // Absolute input silence
+    static constexpr float OffsetDropDb = 40.0f;      // Silence relative to the passage
+    static constexpr float FitStartDb = -5.0f;        // Below the tail's peak
+    static constexpr float FitEndDb = -25.0f;
+    static constexpr float MinFitRangeDb = 10.0f;
+
+    DecayEstimator() = default;
+
+    void setSampleRate(double newSampleRate)
+    {
+        if (newSampleRate > 0.0)
+            sampleRate = newSampleRate;
+    }
+
+    // Abandons any decay being tracked, e.g. after frames were dropped, so a
+    // fit never spans a gap. The last measurement is kept.
+    void reset()
+    {
+        phase = Phase::Idle;
+        passageDb = -120.0f;
+        tailPeakDb = -120.0f;
+        elapsed = 0.0;
+        fit = {};
+    }
+
+    void addFrame(const TelemetryFrame& frame)
+    {
+        const float inputDb = juce::Decibels::gainToDecibels(juce::jmax(frame.inputPeak[0], frame.inputPeak[1]), -120.0f);
+        const float tankDb = juce::Decibels::gainToDecibels(frame.tankEnergy, -120.0f);
+        const double blockSeconds = frame.numSamples / sampleRate;
+
+        const bool inputSilent = inputDb < juce::jmax(SilenceDb, passageDb - OffsetDropDb);
+
+        if (!inputSilent)
+        {
+            // Input present: an interrupted decay still counts if it covered enough range
+            if (phase == Phase::Fitting)
+                finishFit(false);
+
+            passageDb = phase == Phase::Passage ? juce::jmax(passageDb, inputDb) : inputDb;
+            phase = Phase::Passage;
+            return;
+        }
+
+        switch (phase)
+        {
+            case Phase::Idle:
+                return;
+
+            case Phase::Passage:
+                // Offset: wait for the tail to pass its peak
+                phase = Phase::Peak;
+                tailPeakDb = tankDb;
+                elapsed = 0.0;
+                return;
+
+            case Phase::Peak:
+                elapsed += blockSeconds;
+                tailPeakDb = juce::jmax(tailPeakDb, tankDb);
+
+                if (tankDb <= tailPeakDb + FitStartDb)
+                {
+                    phase = Phase::Fitting;
+                    fit = {};
+                    addPoint(elapsed, tankDb);
+                }
+                return;
+
+            case Phase::Fitting:
+                elapsed += blockSeconds;
+                addPoint(elapsed, tankDb);
+
+                if (tankDb <= tailPeakDb + FitEndDb)
+                    finishFit(true);
+                return;
+        }
+    }
+
+    // Most recent RT60 measurement in seconds, or a negative value before the first
+    float getMeasuredDecay() const { return measuredDecay; }
+
+private:
+    enum class Phase
+    {
+        Idle,       // No signal yet
+        Passage,    // Input present
+        Peak,       // Input stopped, tail still building or near its peak
+        Fitting     // Tail decaying through the fit range
+    };
+
+    struct LineFit
+    {
+        double n = 0.0, sumT = 0.0, sumY = 0.0, sumTT = 0.0, sumTY = 0.0;
+        float firstDb = 0.0f, lastDb = 0.0f;
+    };
+
+    void addPoint(double t, float db)
+    {
+        if (fit.n == 0.0)
+            fit.firstDb = db;
+
+        fit.lastDb = db;
+        fit.n += 1.0;
+        fit.sumT += t;
+        fit.sumY += db;
+        fit.sumTT += t * t;
+        fit.sumTY += t * db;
+    }
+
+    void finishFit(bool complete)
+    {
+        phase = Phase::Idle;
+
+        if (!complete && fit.firstDb - fit.lastDb < MinFitRangeDb)
+            return;
+
+        const double denominator = fit.n * fit.sumTT - fit.sumT * fit.sumT;
+        if (fit.n < 3.0 || denominator <= 0.0)
+            return;
+
+        const double slope = (fit.n * fit.sumTY - fit.sumT * fit.sumY) / denominator;   // dB per second
+        if (slope < 0.0)
+            measuredDecay = static_cast<float>(-60.0 / slope);
+    }
+
+    double sampleRate = 48000.0;
+    Phase phase = Phase::Idle;
+
+    float passageDb = -120.0f;
+    float tailPeakDb = -120.0f;
+    double elapsed = 0.0;
+    LineFit fit;
+
+    float measuredDecay = -1.0f;
+};
+
+} // namespace Cosmos
@@ -0,0 +1,3 @@
+#include "Telemetry.h"
+
+// Implementation is inline in header for performance
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+
+namespace Cosmos
+{
+
+//==============================================================================
+// Processing stages timed for the CPU meter
+enum class TelemetryStage
+{
+    PreDelay,
+    Diffusion,
+    Tank,
+    Filters,
+    Fairing,
+    IO,
+    NumStages
+};
+
+constexpr int NumTelemetryStages = static_cast<int>(TelemetryStage::NumStages);
+
+//==============================================================================
+/**
+ * State of the audio engine over one processed block, for the visualizers
+ */
+struct TelemetryFrame
+{
+    int numSamples = 0;
+
+    std::array<float, 2> inputPeak {};
+    std::array<float, 2> outputPeak {};
+    std::array<float, 2> outputRms {};
+    std::array<float, 2> outputTruePeak {};
+
+    float momentaryLufs = -70.0f;   // BS.1770, 400 ms
+    float shortTermLufs = -70.0f;   // BS.1770, 3 s
+
+    float tankEnergy = 0.0f;        // RMS of the reverb tank output
+    float tankMin = 0.0f;           // Lowest and highest tank output sample
+    float tankMax = 0.0f;
+    float decayEnvelope = 0.0f;     // Smoothed tank peak (0-1)
+
+    float fairingPhase = 0.0f;      // Progress through the effect (0-1)
+    float fairingIntensity = 0.0f;
+    bool fairingActive = false;
+
+    float cpuLoad = 0.0f;           // Processing time / block duration
+    std::array<float, NumTelemetryStages> stageLoad {};   // Load per stage, summing to cpuLoad
+};
+
+//==============================================================================
+/**
+ * Preallocated single-producer / single-consumer ring of telemetry frames
+ *
+ * The audio thread pushes one frame per block and the editor drains every
+ * pending frame on its refresh, so visualizers see each block rather than a
+ * single sample of state. push() is wait-free: when the UI falls behind (or
+ * no editor is open) the new frame is dropped and counted instead of
+ * blocking the audio thread.
+ */
+class TelemetryRing
+{
+public:
+    // About 0.3 s of 16-sample blocks at 192 kHz between UI refreshes
+    static constexpr int Capacity = 4096;
+
+    TelemetryRing() = default;
+
+    // Audio thread
+    bool push(const TelemetryFrame& frame) noexcept
+    {
+        const auto scope = fifo.write(1);
+
+        if (scope.blockSize1 == 0)
+        {
+            numDropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+
+        frames[static_cast<size_t>(scope.startIndex1)] = frame;
+        return true;
+    }
+
+    // Message thread: calls handler for each pending frame, oldest first,
+    // and returns the number of frames read
+    template <typename Handler>
+    int drain(Handler&& handler)
+    {
+        const auto scope = fifo.read(fifo.getNumReady());
+
+        for (int i = 0; i < scope.blockSize1; ++i)
+            handler(frames[static_cast<size_t>(scope.startIndex1 + i)]);
+
+        for (int i = 0; i < scope.blockSize2; ++i)
+            handler(frames[static_cast<size_t>(scope.startIndex2 + i)]);
+
+        return scope.blockSize1 + scope.blockSize2;
+    }
+
+    // Frames lost because the consumer fell behind
+    juce::uint32 getNumDropped() const noexcept
+    {
+        return numDropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    juce::AbstractFifo fifo { Capacity };
+    std::array<TelemetryFrame, Capacity> frames {};
+    std::atomic<juce::uint32> numDropped { 0 };
+
+    JUCE_DECLARE_NON_COPYABLE(TelemetryRing)
+};
+
+} // namespace Cosmos